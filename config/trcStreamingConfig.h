@@ -30,6 +30,37 @@ extern "C" {
  */
 #define TRC_CFG_ENTRY_SLOTS 50
 
+/**
+ * @def TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS
+ * @brief Set to the number of entry slots to add each time the entry table
+ * grows, or 0 for an entry table of fixed size.
+ *
+ * The entry table starts with TRC_CFG_ENTRY_SLOTS slots. When fewer than half
+ * a segment of slots are free, xTraceTzCtrl allocates another segment of
+ * this many slots with TRC_KERNEL_PORT_HEAP_MALLOC, outside of any critical
+ * section, until TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS segments have been added.
+ * Segments are never freed or moved, so entry handles stay valid. Objects
+ * that are created faster than xTraceTzCtrl adds segments may still find the
+ * table full.
+ *
+ * Requires TRC_CFG_RECORDER_BUFFER_ALLOCATION_DYNAMIC and a stream port that
+ * doesn't read the entry table directly from RAM (not RingBuffer). The entry
+ * index tables are sized for the largest entry table, using up to 6 bytes of
+ * RAM per slot depending on other options.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS 0
+
+/**
+ * @def TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS
+ * @brief The maximum number of segments that TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS
+ * can add to the entry table.
+ *
+ * Default value is 4.
+ */
+#define TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS 4
+
 /**
  * @def TRC_CFG_ENTRY_SYMBOL_MAX_LENGTH
  * @brief The maximum length of symbol names, including:
@@ -41,9 +72,436 @@ extern "C" {
  * If longer symbol names are used, they will be truncated by the recorder,
  * which will affect the trace display. In that case, there will be warnings
  * (as User Events) from TzCtrl task, that monitors this.
+ *
+ * At most 28, or 255 when TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE is used.
  */
 #define TRC_CFG_ENTRY_SYMBOL_MAX_LENGTH 28
 
+/**
+ * @def TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE
+ * @brief Set to the size in bytes of a shared symbol arena, or 0 to store
+ * symbol names in fixed-size slots in every entry.
+ *
+ * By default every entry reserves room for TRC_CFG_ENTRY_SYMBOL_MAX_LENGTH
+ * characters, whether it has a name or not. With a symbol arena, entries
+ * only hold the offset and length of their name, and the names are stored
+ * back to back in the arena. RAM then scales with the names actually used,
+ * and TRC_CFG_ENTRY_SYMBOL_MAX_LENGTH may be up to 255. Each name uses its
+ * length plus 5 bytes, rounded up to a multiple of 4. The entry table sent
+ * to the host is unchanged.
+ *
+ * Space from deleted and renamed entries is reclaimed by compacting the
+ * arena, in a critical section, when a new name does not fit. Compacting
+ * moves names, so a name returned by xTraceEntryGetSymbol,
+ * xTraceCounterGetName or xTraceExtensionGetConfigName must be read in the
+ * same critical section as the call. Names that do not fit even after
+ * compacting are left out, an entry that is renamed then keeps its old name,
+ * and this is reported as a warning from the TzCtrl task.
+ *
+ * Can't be used with stream ports where the host reads the entry table
+ * directly from RAM, such as RingBuffer. At most 65535 bytes.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE 0
+
+/**
+ * @def TRC_CFG_ENTRY_HASH_INDEX
+ * @brief Set to 1 to keep an address-keyed hash index of the entry table.
+ *
+ * Objects are looked up by address when they are named, deleted or change
+ * priority without a handle, e.g. xTraceObjectSetNameWithoutHandle. Without
+ * the index, every such lookup scans all TRC_CFG_ENTRY_SLOTS entries, often
+ * inside a critical section. With the index, a lookup only probes a few slots.
+ * Lookups, inserts and removals all probe in a critical section, since a
+ * removal moves the following entries back towards their hash slot.
+ *
+ * The index uses 2 bytes per slot, with at least twice as many slots as
+ * TRC_CFG_ENTRY_SLOTS rounded up to a power of two.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_ENTRY_HASH_INDEX 0
+
+/**
+ * @def TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION
+ * @brief Set to 1 to take and give entry slots without a critical section.
+ *
+ * Free entry slots are kept in a lock-free stack, linked through the entry
+ * index table, with a tag in the stack head that is incremented on every
+ * update to avoid the ABA problem. Registering and unregistering objects
+ * by handle then takes no critical section of its own.
+ *
+ * A critical section is still used for the hash index
+ * (TRC_CFG_ENTRY_HASH_INDEX), for the symbol arena
+ * (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE), and in the xTraceObject*WithoutHandle
+ * functions, which find the object by address. Without those, objects are
+ * created and deleted concurrently on all cores without serializing on the
+ * recorder.
+ *
+ * Each taken slot is also marked in a bitmap, so when the same entry is
+ * deleted concurrently from several contexts only one of them succeeds.
+ *
+ * Requires TRC_CFG_ATOMIC_COMPARE_AND_SWAP_32 to be defined in trcConfig.h
+ * unless the compiler provides the GCC __sync builtins.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION 0
+
+/**
+ * @def TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE
+ * @brief Set to the number of entries to send per xTraceTzCtrl call to send
+ * the entry table incrementally when tracing starts, or 0 to send it all at once.
+ *
+ * By default the trace header and the entry table are sent in a critical
+ * section when tracing starts, blocking until the stream port has accepted
+ * all of it. With many entries and a slow link this keeps interrupts disabled
+ * for a long time. With this option the recorder is enabled right away and
+ * the header and entry table are instead written from xTraceTzCtrl, at most
+ * this many entries at a time and without blocking, while events are held in
+ * the internal event buffer until the entry table has been sent.
+ *
+ * The entry table is sent as it was when tracing started. Entries created or
+ * deleted after that are marked with a new entry table generation, so they
+ * are left out of the table and are instead known from their events.
+ *
+ * Requires a stream port that uses the internal event buffer. The internal
+ * event buffer must be large enough to hold the events that are created while
+ * the entry table is sent. Uses 2 bytes of RAM per entry slot.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE 0
+
+/**
+ * @def TRC_CFG_STRING_INTERN_SLOTS
+ * @brief Set to the number of slots in the string intern table, or 0 to
+ * disable string interning.
+ *
+ * By default xTraceStringRegister creates a new entry and stores a name event
+ * every time it is called, even if the same string has already been
+ * registered. With string interning, registered strings are kept in a hash
+ * table over the string text, and registering an identical string again
+ * returns the existing handle without using another entry slot or storing
+ * another event. Strings are compared as stored in the entry table, i.e.
+ * truncated to TRC_CFG_ENTRY_SYMBOL_MAX_LENGTH.
+ *
+ * Must be a power of two, and should be larger than the number of strings
+ * that are registered. When the table is full, new strings are registered
+ * without being interned. Uses sizeof(TraceUnsignedBaseType_t) bytes of RAM
+ * per slot.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_STRING_INTERN_SLOTS 0
+
+/**
+ * @def TRC_CFG_LOCK_FREE_ALLOCATION
+ * @brief Set to 1 to allocate and commit events without a critical section.
+ *
+ * Space for each event is reserved in the per-core event buffer using an
+ * atomic compare-and-swap, and the written data is published through a
+ * separate commit index once all pending writers on that buffer are done.
+ * This allows interrupts to preempt a task that is in the middle of writing
+ * an event, which reduces trace-induced interrupt latency.
+ *
+ * Requires a stream port that allocates directly from an event buffer, i.e.
+ * the internal event buffer with TRC_INTERNAL_EVENT_BUFFER_OPTION_WRITE_MODE_DIRECT
+ * or the RingBuffer stream port with TRC_STREAM_PORT_RINGBUFFER_MODE_STOP_WHEN_FULL.
+ * New events are skipped when the buffer is full.
+ *
+ * Note that an event is timestamped after its space has been reserved, so an
+ * interrupt that preempts the writer in between may store an event with an
+ * earlier timestamp after it in the buffer.
+ *
+ * Requires TRC_CFG_ATOMIC_COMPARE_AND_SWAP_32 to be defined in trcConfig.h
+ * unless the compiler provides the GCC __sync builtins.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_LOCK_FREE_ALLOCATION 0
+
+/**
+ * @def TRC_CFG_OBJECT_REGISTER_BATCH
+ * @brief Set to 1 to store the name event and the create event of an object
+ * as one event batch.
+ *
+ * The two events then share one critical section, one timestamp and, with
+ * stream ports that allocate from an event buffer, one allocation (see
+ * xTraceEventBatchBegin). The batch is placed on the stack of the task that
+ * registers the object and takes TRC_EVENT_BATCH_SIZE bytes, by default twice
+ * TRC_MAX_BLOB_SIZE, and the events are copied twice. Only enable this if all
+ * tasks that create kernel objects have room for it on their stacks.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_OBJECT_REGISTER_BATCH 0
+
+/**
+ * @def TRC_CFG_ENABLE_EVENT_FILTER
+ * @brief Set to 1 to be able to exclude events by event ID at runtime.
+ *
+ * A bitmap with one bit per event ID is checked before an event is created,
+ * before any critical section is entered. Events are excluded and included
+ * again using xTraceEventFilterExclude and xTraceEventFilterInclude, or from
+ * the host using the CMD_SET_EVENT_FILTER command. This allows noisy events to
+ * be removed from the stream without rebuilding with other TRC_CFG_INCLUDE_*
+ * settings.
+ *
+ * The bitmap uses 512 bytes of RAM.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_ENABLE_EVENT_FILTER 0
+
+/**
+ * @def TRC_CFG_ENABLE_FRAGMENTED_EVENTS
+ * @brief Set to 1 to be able to store payloads larger than TRC_MAX_BLOB_SIZE
+ * using xTraceEventCreateDataFragmented.
+ *
+ * The payload is split into several events with a sequence ID and a fragment
+ * index, which the host uses to reassemble it. Uses 8 bytes of RAM for the
+ * sequence counter.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_ENABLE_FRAGMENTED_EVENTS 0
+
+/**
+ * @def TRC_CFG_ENABLE_TASK_EXCLUSION
+ * @brief Set to 1 to be able to exclude the events of specific tasks.
+ *
+ * Tasks are excluded using vTraceExcludeTask or xTraceTaskExclude. Events
+ * created while an excluded task is running, outside of ISRs, are dropped
+ * before any critical section is entered. Task switches to excluded tasks are
+ * still stored, so that the timeline and CPU load remain correct. Object
+ * names, creates and deletes from excluded tasks are also stored, so the
+ * objects they create are still known by name.
+ *
+ * This is useful for high-rate tasks whose events are not of interest, e.g. a
+ * network stack task.
+ *
+ * While any task is excluded, each task switch looks up the entry of the task
+ * that is switched in. Requires TRC_CFG_ENTRY_HASH_INDEX, so this lookup only
+ * probes a few slots. Unregistered tasks are no longer counted as excluded.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_ENABLE_TASK_EXCLUSION 0
+
+/**
+ * @def TRC_CFG_COMPACT_EVENT_HEADER
+ * @brief Set to 1 to use a 4 byte event header instead of the 8 byte header.
+ *
+ * The compact header holds the event ID and a 16-bit timestamp delta relative
+ * to the previous event, instead of the event count and the full 32-bit
+ * timestamp. A timestamp extension event (PSF_EVENT_TS_EXTENSION), holding the
+ * full timestamp and event count, is stored before an event whose delta does
+ * not fit in 16 bits, and before the first event after events were lost.
+ * This saves 4 bytes per event, which is most of a task switch event, on
+ * streaming links with limited bandwidth such as RTT or ITM.
+ *
+ * Requires a 32-bit TraceUnsignedBaseType_t, TRC_CFG_CORE_COUNT set to 1 and
+ * TRC_CFG_LOCK_FREE_ALLOCATION set to 0. Hardware ports with another base type
+ * must define TRC_BASE_TYPE_SIZE, so this is checked at compile time. Cannot be used with the RingBuffer
+ * stream port in TRC_STREAM_PORT_RINGBUFFER_MODE_OVERWRITE_WHEN_FULL mode,
+ * since overwritten extension events cannot be recovered.
+ *
+ * The host must support the compact header, which is indicated by bit 4 of
+ * the options field in the trace header.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_COMPACT_EVENT_HEADER 0
+
+/**
+ * @def TRC_CFG_EXTENDED_EVENT_HEADER
+ * @brief Set to 1 to use a 12 byte event header with a wider core ID and event
+ * count. The header is padded to 16 bytes with a 64-bit base type.
+ *
+ * The normal 8 byte header holds the core ID in 4 bits and the event count in
+ * 12 bits of a shared 16-bit field. This limits the recorder to 16 cores, and
+ * the event count wraps every 4096 events, so lost events can't be counted
+ * reliably on busy cores. The extended header holds the event ID, a 16-bit core
+ * ID, the 32-bit timestamp (at the same offset as before) and a 32-bit event
+ * count per core.
+ *
+ * With a 64-bit TraceUnsignedBaseType_t, 4 bytes of padding follow the event
+ * count so the parameters stay aligned. Hardware ports with a 64-bit base type
+ * must define TRC_BASE_TYPE_SIZE to 8. Cannot be used together with
+ * TRC_CFG_COMPACT_EVENT_HEADER.
+ *
+ * The host must support the extended header, which is indicated by bit 5 of
+ * the options field in the trace header.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_EXTENDED_EVENT_HEADER 0
+
+/**
+ * @def TRC_CFG_EVENT_LOSS_RECORDS
+ * @brief Set to 1 to store a record of lost events when there is room again.
+ *
+ * When an event buffer that skips new events is full, e.g. the internal event
+ * buffer or the RingBuffer stream port in TRC_STREAM_PORT_RINGBUFFER_MODE_STOP_WHEN_FULL
+ * mode, the number of dropped events and bytes is always counted per core in
+ * the event buffer. With this option, an events lost record (PSF_EVENT_EVENTS_LOST)
+ * is also stored after the first event that fits again. It holds the number of
+ * events and bytes lost since the previous record, and the timestamps of the
+ * first and the last lost event, which shows how much larger the buffer needs
+ * to be.
+ *
+ * Can't be used together with TRC_CFG_LOCK_FREE_ALLOCATION.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_EVENT_LOSS_RECORDS 0
+
+/**
+ * @def TRC_CFG_EVENT_BUFFER_POWER_OF_TWO
+ * @brief Set to 1 to use power of two sized event buffers.
+ *
+ * Positions in the event buffers then wrap using a bit mask instead of a
+ * modulo operation, which avoids a division for every stored event. This
+ * matters on cores without a hardware divider, such as Cortex-M0 and M0+.
+ *
+ * The event buffer of each core is rounded down to the nearest power of two
+ * when the buffer is split between the cores, so for the best use of RAM the
+ * configured buffer size divided by TRC_CFG_CORE_COUNT should be slightly
+ * larger than a power of two, e.g. 8192 + 128 bytes.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_EVENT_BUFFER_POWER_OF_TWO 0
+
+/**
+ * @def TRC_CFG_CORE_BUFFER_WEIGHTS
+ * @brief Define to split the event buffer unevenly between the cores.
+ *
+ * By default each core gets an equal share of the event buffer. On targets
+ * where some cores produce many more events than others, define this as an
+ * initializer with one weight per core, e.g. { 5, 1 } to give the first core
+ * five sixths of the buffer on a dual core target. The number of weights must
+ * match TRC_CFG_CORE_COUNT, which is checked at compile time, and no weight may
+ * be 0. Initialization fails if a core gets too small a share of the buffer.
+ *
+ * Use xTraceEventBufferGetDropped or events lost records (see
+ * TRC_CFG_EVENT_LOSS_RECORDS) to find out which cores run out of room.
+ *
+ * Not defined by default.
+ */
+/* #define TRC_CFG_CORE_BUFFER_WEIGHTS { 1, 1 } */
+
+/**
+ * @def TRC_CFG_ORDERED_TRANSFER
+ * @brief Set to 1 to merge the event buffers of the cores by timestamp when
+ * they are transferred.
+ *
+ * By default the event buffer of each core is transferred in turn, so the
+ * host receives long runs of events from one core at a time and has to sort
+ * the stream. With this option, the oldest events of all cores are sent
+ * first, in runs that end where another core has an older event. This keeps
+ * the memory and latency needed by the host bounded on long multi-core
+ * recordings.
+ *
+ * Only the stream ports that use the internal event buffer are affected.
+ * Can't be used together with TRC_CFG_COMPACT_EVENT_HEADER.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_ORDERED_TRANSFER 0
+
+/**
+ * @def TRC_CFG_EVENT_BUFFER_SEGMENTS
+ * @brief The number of segments that event buffers in overwrite mode are
+ * indexed by, or 0 to not use an index.
+ *
+ * When an event buffer that overwrites old events is full, e.g. the RingBuffer
+ * stream port in TRC_STREAM_PORT_RINGBUFFER_MODE_OVERWRITE_WHEN_FULL mode, the
+ * oldest events are freed one at a time inside the critical section of the
+ * new event, so a large event may have to free dozens of small ones. With an
+ * index, the offset of the first event that starts in each segment of the
+ * buffer is kept, and the oldest events are freed a whole segment at a time.
+ * Only the events within one segment are then freed one at a time.
+ *
+ * Segments are a power of two bytes, at most 32 KB, so the event buffer of
+ * each core can be at most 32 KB times this value, or initialization fails.
+ * The index uses 2 bytes per segment and core.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_EVENT_BUFFER_SEGMENTS 0
+
+/**
+ * @def TRC_CFG_PRINT_INTERN_FORMAT_STRINGS
+ * @brief Set to 1 to send each format string used with xTracePrintF only once.
+ *
+ * Normally every xTracePrintF event carries the whole format string. With this
+ * option, the first call with a format string registers it in the entry
+ * table, keyed by its address, and stores it in a name event. Later calls then
+ * only store the channel, a handle to the format string and the arguments,
+ * like xTracePrintF0 to xTracePrintF4. Calls with more than 4 arguments, or
+ * when the entry table is full, still send the whole format string.
+ *
+ * The format strings must be constant, since a format string is recognized by
+ * its address only. Each distinct format string uses one entry table slot
+ * (TRC_CFG_ENTRY_SLOTS).
+ *
+ * Every call looks up its format string in the entry table. Requires
+ * TRC_CFG_ENTRY_HASH_INDEX, so this lookup only probes a few slots.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_PRINT_INTERN_FORMAT_STRINGS 0
+
+/**
+ * @def TRC_CFG_PRINT_TYPED_ARGUMENTS
+ * @brief Set to 1 to store 64-bit and floating-point xTracePrintF arguments at
+ * their natural width.
+ *
+ * Normally every xTracePrintF argument is read and stored as one
+ * TraceUnsignedBaseType_t, which truncates %lld arguments and breaks %f
+ * arguments (and all arguments after them) on 32-bit targets. With this option,
+ * %lld/%llu/%llx arguments (and %ld, %jd, %zu and %td where those types are
+ * 64-bit) are stored as 64-bit integers and %f/%e/%g/%a arguments as 64-bit
+ * doubles, without any floating-point conversion in the recorder. %Lf
+ * arguments are converted to double.
+ * The conversion specifiers of an interned format string (see
+ * TRC_CFG_PRINT_INTERN_FORMAT_STRINGS) are only parsed once.
+ *
+ * This changes the event format for such arguments, so Tracealyzer must be
+ * able to decode typed arguments.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_PRINT_TYPED_ARGUMENTS 0
+
+/**
+ * @def TRC_CFG_CACHE_LINE_SIZE
+ * @brief The data cache line size in bytes, used to keep the recorder state of
+ * each core on cache lines of its own.
+ *
+ * On multi-core targets with data caches, the per-core recorder state (event
+ * counters, ISR stacks, system states and event buffer indexes) is otherwise
+ * packed together, so every event on one core invalidates the cache line of
+ * the other cores (false sharing). Set this to the cache line size (e.g. 64 on
+ * Cortex-A, 32 on ESP32) to align and pad this state, at the cost of some RAM.
+ * Set to 0 to pack it as before.
+ *
+ * The alignment uses __attribute__((aligned)) with GCC and Clang. Other
+ * compilers must define TRC_CFG_CACHE_LINE_ALIGNED in trcConfig.h, e.g.
+ * #define TRC_CFG_CACHE_LINE_ALIGNED _Alignas(64). With
+ * TRC_RECORDER_BUFFER_ALLOCATION_DYNAMIC or _CUSTOM, the recorder buffer should
+ * be aligned to the cache line size as well.
+ *
+ * This changes the layout of the event buffers, which matters when the
+ * RingBuffer stream port is read from a memory dump.
+ *
+ * Default value is 0.
+ */
+#define TRC_CFG_CACHE_LINE_SIZE 0
+
 #ifdef __cplusplus
 }
 #endif
@@ -150,6 +150,10 @@ traceResult xTraceCounterSet(TraceCounterHandle_t xCounterHandle, TraceBaseType_
 /**
  * @brief Gets trace counter name.
  * 
+ * With TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE, the name is moved when the symbol
+ * arena is compacted, so it must be read in the same critical section as
+ * the call.
+ * 
  * @param[in] xCounterHandle Initialized trace counter handle.
  * @param[out] pszName Returned name.
  * 
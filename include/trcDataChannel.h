@@ -0,0 +1,129 @@
+/*
+* Percepio Trace Recorder for Tracealyzer v4.10.3
+* Copyright 2023 Percepio AB
+* www.percepio.com
+*
+* SPDX-License-Identifier: Apache-2.0
+*/
+
+/**
+ * @file 
+ * 
+ * @brief Public trace data channel APIs.
+ */
+
+#ifndef TRC_DATA_CHANNEL_H
+#define TRC_DATA_CHANNEL_H
+
+#if (TRC_USE_TRACEALYZER_RECORDER == 1) && (TRC_CFG_RECORDER_MODE == TRC_RECORDER_MODE_STREAMING)
+
+#include <trcTypes.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup trace_data_channel_apis Trace Data Channel APIs
+ * @ingroup trace_recorder_apis
+ * @{
+ */
+
+typedef TraceEventReservation_t TraceDataChannelReservation_t;
+
+/**
+ * @brief Creates a binary data channel.
+ *
+ * The channel is registered as a trace extension with one event, so each
+ * channel gets an event code of its own and its data events carry nothing but
+ * the data.
+ *
+ * @param[in] szName Name.
+ * @param[out] pxDataChannelHandle Pointer to uninitialized data channel handle.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceDataChannelCreate(const char* szName, TraceDataChannelHandle_t* pxDataChannelHandle);
+
+/**
+ * @brief Writes binary data to a data channel.
+ *
+ * The data is copied straight into the event. Data larger than
+ * TRC_MAX_BLOB_SIZE minus the event header is truncated.
+ *
+ * @param[in] xDataChannelHandle Data channel handle.
+ * @param[in] pvData Pointer to data.
+ * @param[in] uiSize Data size.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceDataChannelWrite(TraceDataChannelHandle_t xDataChannelHandle, const void* pvData, uint32_t uiSize);
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+/**
+ * @brief Reserves space for binary data in the event buffer.
+ *
+ * The data is written in place, e.g. by a DMA completion handler, and then
+ * committed with xTraceDataChannelCommit. See xTraceEventReserve.
+ *
+ * Example:
+ *	 TraceDataChannelReservation_t xReservation;
+ *	 void* pvSamples;
+ *	 if (xTraceDataChannelReserve(xAdcChannel, sizeof(adc_samples), &pvSamples, &xReservation) == TRC_SUCCESS)
+ *	 {
+ *		 memcpy(pvSamples, adc_samples, sizeof(adc_samples));
+ *		 xTraceDataChannelCommit(&xReservation);
+ *	 }
+ *
+ * @param[in] xDataChannelHandle Data channel handle.
+ * @param[in] uiSize Data size, at most TRC_MAX_BLOB_SIZE minus the event header.
+ * @param[out] ppvData Pointer to the data in the event buffer.
+ * @param[out] pxReservation Pointer to reservation.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceDataChannelReserve(TraceDataChannelHandle_t xDataChannelHandle, uint32_t uiSize, void** ppvData, TraceDataChannelReservation_t* pxReservation);
+
+/**
+ * @brief Commits data reserved with xTraceDataChannelReserve.
+ *
+ * @param[in] pxReservation Pointer to reservation.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+#define xTraceDataChannelCommit(pxReservation) xTraceEventCommitReservation(pxReservation)
+#else
+/* Without lock-free allocation the event buffer can't be left reserved, so data must be written with xTraceDataChannelWrite */
+#define xTraceDataChannelReserve(_xDataChannelHandle, _uiSize, _ppvData, _pxReservation) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_5((void)(_xDataChannelHandle), (void)(_uiSize), (void)(_ppvData), (void)(_pxReservation), TRC_FAIL)
+
+#define xTraceDataChannelCommit(_pxReservation) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)(_pxReservation), TRC_FAIL)
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#else
+
+typedef struct TraceDataChannelReservation
+{
+	void* pvEvent;
+} TraceDataChannelReservation_t;
+
+#define xTraceDataChannelCreate(_szName, _pxDataChannelHandle) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)(_szName), (void)(_pxDataChannelHandle), TRC_SUCCESS)
+
+#define xTraceDataChannelWrite(_xDataChannelHandle, _pvData, _uiSize) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_4((void)(_xDataChannelHandle), (void)(_pvData), (void)(_uiSize), TRC_SUCCESS)
+
+#define xTraceDataChannelReserve(_xDataChannelHandle, _uiSize, _ppvData, _pxReservation) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_5((void)(_xDataChannelHandle), (void)(_uiSize), (void)(_ppvData), (void)(_pxReservation), TRC_FAIL)
+
+#define xTraceDataChannelCommit(_pxReservation) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)(_pxReservation), TRC_FAIL)
+
+#endif
+
+#endif
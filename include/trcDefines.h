@@ -34,9 +34,10 @@
 
 /* Command codes for TzCtrl task */
 #define CMD_SET_ACTIVE      1 /* Start (param1 = 1) or Stop (param1 = 0) */
+#define CMD_SET_EVENT_FILTER 2 /* Exclude (param3 = 1) or include (param3 = 0) param4 event IDs (1 if 0), starting at event ID param1 | (param2 << 8) */
 
 /* The final command code, used to validate commands. */
-#define CMD_LAST_COMMAND 1
+#define CMD_LAST_COMMAND 2
 
 #define TRC_RECORDER_MODE_SNAPSHOT		0
 #define TRC_RECORDER_MODE_STREAMING		1
@@ -72,6 +73,7 @@
 #define TRC_WARNING_STREAM_PORT_WRITE				0x0CUL
 #define TRC_WARNING_STREAM_PORT_INITIAL_BLOCKING	0x0DUL
 #define TRC_WARNING_STACKMON_NO_SLOTS				0x0EUL
+#define TRC_WARNING_ENTRY_SYMBOL_ARENA				0x0FUL
 
 /* Entry Option definitions */
 #define TRC_ENTRY_OPTION_EXCLUDED				0x00000001UL
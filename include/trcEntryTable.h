@@ -35,7 +35,9 @@ extern "C" {
 #define TRC_ENTRY_CLEAR_OPTIONS(xEntryHandle, uiMask) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(((TraceEntry_t*)(xEntryHandle))->uiOptions &= ~(uiMask), TRC_SUCCESS)
 #define TRC_ENTRY_GET_ADDRESS(xEntryHandle, ppvAddress) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(*(ppvAddress) = ((TraceEntry_t*)(xEntryHandle))->pvAddress, TRC_SUCCESS)
 #define TRC_ENTRY_GET_ADDRESS_RETURN(xEntryHandle) (((TraceEntry_t*)(xEntryHandle))->pvAddress)
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE == 0)
 #define TRC_ENTRY_GET_SYMBOL(xEntryHandle, pszSymbol) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(*(pszSymbol) = ((TraceEntry_t*)(xEntryHandle))->szSymbol, TRC_SUCCESS)
+#endif
 #define TRC_ENTRY_GET_STATE(xEntryHandle, uxStateIndex, puxState) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(*(puxState) = ((TraceEntry_t*)(xEntryHandle))->xStates[uxStateIndex], TRC_SUCCESS)
 #define TRC_ENTRY_GET_STATE_RETURN(xEntryHandle, uxStateIndex) (((TraceEntry_t*)(xEntryHandle))->xStates[uxStateIndex])
 #define TRC_ENTRY_GET_OPTIONS(xEntryHandle, puiOptions) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(*(puiOptions) = ((TraceEntry_t*)(xEntryHandle))->uiOptions, TRC_SUCCESS)
@@ -46,23 +48,130 @@ extern "C" {
 /* TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE has to be aligned to TraceUnsignedBaseType_t but with a uint32_t padding to ensure that TraceEntry_t size is aligned (uiOptions is uint32_t) */
 #define TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE (((((sizeof(char) * (uint32_t)(TRC_ENTRY_TABLE_SYMBOL_LENGTH) - sizeof(uint32_t)) + (sizeof(TraceUnsignedBaseType_t) - 1UL)) / sizeof(TraceUnsignedBaseType_t)) * sizeof(TraceUnsignedBaseType_t)) + sizeof(uint32_t))
 
-#if (TRC_CFG_ENTRY_SLOTS > 256UL)
+#if (TRC_CFG_ENTRY_SLOTS > 256UL) || (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1) || (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0) /* The lock-free free list links slots by index + 1, and segments add slots */
 typedef uint16_t TraceEntryIndex_t;
 #define TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE (4) /* Must align to 64-bit (sizeof(uint64_t) / sizeof(uint16_t)) */
+#define TRC_ENTRY_INDEX_NONE UINT16_MAX /* Marks an unused place in the free index list */
 #else
 typedef uint8_t TraceEntryIndex_t;
 #define TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE (8)	/* Must align to 64-bit (sizeof(uint64_t) / sizeof(uint8_t)) */
+#define TRC_ENTRY_INDEX_NONE UINT8_MAX /* Marks an unused place in the free index list */
+#endif
+
+/* The slots in the entry table itself */
+#define TRC_ENTRY_TABLE_STATIC_SLOTS ((((TRC_CFG_ENTRY_SLOTS) + (TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE) - 1) / TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE) * TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE)
+
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+
+#if ((TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS) < 1)
+#error "TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS must be at least 1 when TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS is used!"
 #endif
 
-#define TRC_ENTRY_TABLE_SLOTS ((((TRC_CFG_ENTRY_SLOTS) + (TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE) - 1) / TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE) * TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE)
+/* Aligned like the entry table so the total stays aligned */
+#define TRC_ENTRY_TABLE_SEGMENT_SLOTS ((((TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS) + (TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE) - 1) / TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE) * TRC_ENTRY_INDEX_ALIGNMENT_MULTIPLE)
+
+/* The most slots the entry table can grow to. Entry indexes continue from the entry table into the segments. */
+#define TRC_ENTRY_TABLE_SLOTS ((TRC_ENTRY_TABLE_STATIC_SLOTS) + ((TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS) * (TRC_ENTRY_TABLE_SEGMENT_SLOTS)))
+
+#else
+
+#define TRC_ENTRY_TABLE_SLOTS (TRC_ENTRY_TABLE_STATIC_SLOTS)
+
+#endif
+
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+
+/* The hash index has at least twice as many slots as the entry table, rounded up to a power of two */
+#if ((TRC_ENTRY_TABLE_SLOTS) <= 32)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (6)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 64)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (7)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 128)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (8)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 256)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (9)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 512)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (10)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 1024)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (11)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 2048)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (12)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 4096)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (13)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 8192)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (14)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 16384)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (15)
+#elif ((TRC_ENTRY_TABLE_SLOTS) <= 32768)
+#define TRC_ENTRY_HASH_SLOTS_SHIFT (16)
+#else
+#error "TRC_CFG_ENTRY_HASH_INDEX supports at most 32768 entry slots!"
+#endif
+
+#define TRC_ENTRY_HASH_SLOTS (1UL << (TRC_ENTRY_HASH_SLOTS_SHIFT))
+
+#endif
+
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1)
+
+/* One bit per slot, in an even number of words so the size is aligned to 64-bit */
+#define TRC_ENTRY_TAKEN_WORDS ((((TRC_ENTRY_TABLE_SLOTS) + 63) / 64) * 2)
+
+#endif
 
 typedef struct EntryIndexTable	/* Aligned because TRC_ENTRY_TABLE_SLOTS is always a multiple that aligns to 64-bit */
 {
 	TraceEntryIndex_t axFreeIndexes[TRC_ENTRY_TABLE_SLOTS];	/* slot count and size is aligned to 64-bit */
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+	uint16_t auiAddressHash[TRC_ENTRY_HASH_SLOTS];			/* entry index + 1, or 0 if empty. Size is aligned to 64-bit */
+#endif
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0)
+	uint16_t auiGenerations[TRC_ENTRY_TABLE_SLOTS];			/* generation of the last create or delete of each slot. Size is aligned to 64-bit */
+#endif
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1)
+	uint32_t auiTaken[TRC_ENTRY_TAKEN_WORDS];				/* one bit per slot, set while the slot is taken. Size is aligned to 64-bit */
+#endif
 	uint32_t uiFreeIndexCount;
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1)
+	uint32_t uiFreeListHead;	/* ABA tag in the upper 16 bits, top index + 1 in the lower 16 bits, or 0 if empty */
+#else
 	uint32_t reserved;			/* alignment */
+#endif
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0)
+	uint32_t uiGeneration;
+	uint32_t reserved2;			/* alignment */
+#endif
 } TraceEntryIndexTable_t;
 
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+
+#if ((TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE) > 0xFFFF)
+#error "TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE can be at most 65535 bytes!"
+#endif
+
+#define TRC_ENTRY_SYMBOL_ARENA_SIZE (((uint32_t)(TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE) + (sizeof(uint32_t) - 1UL)) / sizeof(uint32_t) * sizeof(uint32_t))
+
+/** Trace Entry Structure */
+typedef struct TraceEntry	/* Aligned because uiOptions, uiSymbolOffset and uiSymbolLength add up to 64 bits */
+{
+	void* pvAddress;												/**< */
+	TraceUnsignedBaseType_t xStates[TRC_ENTRY_TABLE_STATE_COUNT];	/**< */
+	uint32_t uiOptions;												/**< */
+	uint16_t uiSymbolOffset;										/**< Offset of the symbol in the symbol arena */
+	uint16_t uiSymbolLength;										/**< Symbol length, 0 if there is no symbol */
+} TraceEntry_t;
+
+/** Trace entry as it is sent to the host */
+typedef struct TraceEntryRecord	/* Aligned because TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE will align together with uiOptions */
+{
+	void* pvAddress;												/**< */
+	TraceUnsignedBaseType_t xStates[TRC_ENTRY_TABLE_STATE_COUNT];	/**< */
+	uint32_t uiOptions;												/**< */
+	char szSymbol[TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE];				/**< */
+} TraceEntryRecord_t;
+
+#else
+
 /** Trace Entry Structure */
 typedef struct TraceEntry	/* Aligned because TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE will align together with uiOptions */
 {
@@ -72,12 +181,27 @@ typedef struct TraceEntry	/* Aligned because TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE wi
 	char szSymbol[TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE];				/**< */
 } TraceEntry_t;
 
+/** Trace entry as it is sent to the host */
+typedef TraceEntry_t TraceEntryRecord_t;
+
+#endif
+
 typedef struct TraceEntryTable	/* Aligned */
 {
 	TraceUnsignedBaseType_t uxSlots;
 	TraceUnsignedBaseType_t uxEntrySymbolLength;
 	TraceUnsignedBaseType_t uxEntryStateCount;
-	TraceEntry_t axEntries[TRC_ENTRY_TABLE_SLOTS];
+	TraceEntry_t axEntries[TRC_ENTRY_TABLE_STATIC_SLOTS];
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+	uint32_t uiSymbolArenaHead;										/* Bytes of the symbol arena in use */
+	uint32_t reserved;												/* alignment */
+	uint32_t auiSymbolArena[TRC_ENTRY_SYMBOL_ARENA_SIZE / sizeof(uint32_t)];	/* Symbols, each preceded by its owner and block size */
+#endif
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+	TraceEntry_t* apxSegments[TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS];	/* Slots added when the entry table grows, in order */
+	uint32_t uiSegmentCount;										/* Set after the segment pointer, so handles are valid before the slots can be taken */
+	uint32_t reserved2;												/* alignment */
+#endif
 } TraceEntryTable_t;
 
 /**
@@ -129,6 +253,9 @@ traceResult xTraceEntryDelete(TraceEntryHandle_t xEntryHandle);
 /**
  * @brief Finds trace entry mapped to object address.
  * 
+ * With TRC_CFG_ENTRY_HASH_INDEX, the probe runs in a critical section since
+ * removing an entry moves others within the hash index.
+ * 
  * @param[in] pvAddress Address of object.
  * @param[out] pxEntryHandle Pointer to uninitialized trace entry handle.
  * 
@@ -150,6 +277,9 @@ traceResult xTraceEntryGetCount(uint32_t* puiCount);
 /**
  * @brief Gets trace table entry at index. 
  * 
+ * Fails for indexes in segments that the entry table has not grown into yet,
+ * see TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS.
+ * 
  * @param[in] index Entry index.
  * @param[out] pxEntryHandle Pointer to uninitialized trace entry handle. 
  * 
@@ -158,6 +288,53 @@ traceResult xTraceEntryGetCount(uint32_t* puiCount);
  */
 traceResult xTraceEntryGetAtIndex(uint32_t index, TraceEntryHandle_t* pxEntryHandle);
 
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+
+/**
+ * @internal Grows the entry table by one segment if it is running out of free slots.
+ * 
+ * Allocates the segment with TRC_KERNEL_PORT_HEAP_MALLOC, so it must be called
+ * from a context where that is allowed, outside of any critical section. Must
+ * only be called from one context, which is xTraceTzCtrl.
+ * 
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEntryTableGrow(void);
+
+#else
+
+#define xTraceEntryTableGrow() TRC_COMMA_EXPR_TO_STATEMENT_EXPR_1(TRC_SUCCESS)
+
+#endif
+
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0)
+
+/**
+ * @internal Starts a new entry table generation.
+ * 
+ * Entry slots that are created or deleted after this call are marked with the
+ * new generation, which lets the recorder send the entry table as it was at
+ * this point while entries keep changing.
+ * 
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEntryGenerationIncrease(void);
+
+/**
+ * @internal Checks if an entry slot was created or deleted in the current generation.
+ * 
+ * @param[in] index Entry index.
+ * @param[out] puiChanged 1 if the slot has changed, otherwise 0.
+ * 
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEntryIsChangedAtIndex(uint32_t index, uint32_t* puiChanged);
+
+#endif
+
 /**
  * @brief Sets symbol for entry.
  * 
@@ -170,7 +347,37 @@ traceResult xTraceEntryGetAtIndex(uint32_t index, TraceEntryHandle_t* pxEntryHan
  */
 traceResult xTraceEntrySetSymbol(const TraceEntryHandle_t xEntryHandle, const char* szSymbol, uint32_t uiLength);
 
-#if ((TRC_CFG_USE_TRACE_ASSERT) == 1)
+/**
+ * @internal Gets a trace entry as it is sent to the host.
+ * 
+ * @param[in] xEntryHandle Pointer to initialized trace entry handle.
+ * @param[out] pxRecord Entry record.
+ * 
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEntryGetRecord(const TraceEntryHandle_t xEntryHandle, TraceEntryRecord_t* pxRecord);
+
+#if ((TRC_CFG_USE_TRACE_ASSERT) == 1) || (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+
+/**
+ * @brief Gets symbol for trace entry.
+ * 
+ * With TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE, symbols are moved when the arena is
+ * compacted, so the symbol must be read in the same critical section as the
+ * call, or be copied with xTraceEntryGetRecord.
+ * 
+ * @param[in] xEntryHandle Pointer to initialized trace entry handle.
+ * @param[out] pszSymbol Symbol.
+ * 
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEntryGetSymbol(const TraceEntryHandle_t xEntryHandle, const char** pszSymbol);
+
+#endif
+
+#if ((TRC_CFG_USE_TRACE_ASSERT) == 1) || (TRC_CFG_ENTRY_HASH_INDEX == 1)
 
 /**
  * @brief Creates trace entry mapped to memory address.
@@ -183,6 +390,10 @@ traceResult xTraceEntrySetSymbol(const TraceEntryHandle_t xEntryHandle, const ch
  */
 traceResult xTraceEntryCreateWithAddress(void* const pvAddress, TraceEntryHandle_t* pxEntryHandle);
 
+#endif
+
+#if ((TRC_CFG_USE_TRACE_ASSERT) == 1)
+
 /**
  * @brief Sets trace entry state.
  * 
@@ -237,17 +448,6 @@ traceResult xTraceEntryGetAddress(const TraceEntryHandle_t xEntryHandle, void **
  */
 void* xTraceEntryGetAddressReturn(const TraceEntryHandle_t xEntryHandle);
 
-/**
- * @brief Gets symbol for trace entry.
- * 
- * @param[in] xEntryHandle Pointer to initialized trace entry handle.
- * @param[out] pszSymbol Symbol.
- * 
- * @retval TRC_FAIL Failure
- * @retval TRC_SUCCESS Success
- */
-traceResult xTraceEntryGetSymbol(const TraceEntryHandle_t xEntryHandle, const char** pszSymbol);
-
 /**
  * @brief Gets state for trace entry.
  * 
@@ -283,7 +483,9 @@ traceResult xTraceEntryGetOptions(const TraceEntryHandle_t xEntryHandle, uint32_
 
 #else
 
+#if (TRC_CFG_ENTRY_HASH_INDEX == 0)
 #define xTraceEntryCreateWithAddress TRC_ENTRY_CREATE_WITH_ADDRESS
+#endif
 
 #define xTraceEntrySetState TRC_ENTRY_SET_STATE
 #define xTraceEntrySetOptions TRC_ENTRY_SET_OPTIONS
@@ -291,7 +493,9 @@ traceResult xTraceEntryGetOptions(const TraceEntryHandle_t xEntryHandle, uint32_
 
 #define xTraceEntryGetAddress TRC_ENTRY_GET_ADDRESS
 #define xTraceEntryGetAddressReturn TRC_ENTRY_GET_ADDRESS_RETURN
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE == 0)
 #define xTraceEntryGetSymbol TRC_ENTRY_GET_SYMBOL
+#endif
 #define xTraceEntryGetState TRC_ENTRY_GET_STATE
 #define xTraceEntryGetStateReturn TRC_ENTRY_GET_STATE_RETURN
 #define xTraceEntryGetOptions TRC_ENTRY_GET_OPTIONS
@@ -316,8 +520,16 @@ traceResult xTraceEntryGetOptions(const TraceEntryHandle_t xEntryHandle, uint32_
 
 #define xTraceEntryGetAtIndex(_index, _pxEntryHandle) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)(_index), (void)(_pxEntryHandle), TRC_SUCCESS)
 
+#define xTraceEntryGenerationIncrease() (void)(TRC_SUCCESS)
+
+#define xTraceEntryTableGrow() TRC_COMMA_EXPR_TO_STATEMENT_EXPR_1(TRC_SUCCESS)
+
+#define xTraceEntryIsChangedAtIndex(_index, _puiChanged) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)(_index), (void)(_puiChanged), TRC_SUCCESS)
+
 #define xTraceEntrySetSymbol(_xEntryHandle, _szSymbol, _uiLength) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_4((void)(_xEntryHandle), (void)(_szSymbol), (void)(_uiLength), TRC_SUCCESS)
 
+#define xTraceEntryGetRecord(_xEntryHandle, _pxRecord) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)(_xEntryHandle), (void)(_pxRecord), TRC_SUCCESS)
+
 #define xTraceEntryCreateWithAddress(_pvAddress, _pxEntryHandle) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)(_pvAddress), (void)(_pxEntryHandle), TRC_SUCCESS)
 
 #define xTraceEntrySetState(_xEntryHandle, _uxStateIndex, _uxState) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_4((void)(_xEntryHandle), (void)(_uxStateIndex), (void)(_uxState), TRC_SUCCESS)
@@ -36,8 +36,19 @@ extern "C" {
  */
 typedef struct {	/* Aligned */
 	uint16_t EventID;		/**< */
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	uint16_t DTS;			/**< Timestamp delta since previous event */
+#elif (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+	uint16_t CoreID;		/**< */
+	uint32_t TS;			/**< */
+	uint32_t EventCount;	/**< */
+#if (TRC_BASE_TYPE_SIZE == 8)
+	uint32_t Padding;		/**< Aligns 64-bit parameters */
+#endif
+#else
 	uint16_t EventCount;	/**< */
 	uint32_t TS;			/**< */
+#endif
 } TraceEvent0_t;
 
 /**
@@ -45,8 +56,19 @@ typedef struct {	/* Aligned */
  */
 typedef struct {	/* Aligned */
 	uint16_t EventID;						/**< */
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	uint16_t DTS;							/**< Timestamp delta since previous event */
+#elif (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+	uint16_t CoreID;						/**< */
+	uint32_t TS;							/**< */
+	uint32_t EventCount;					/**< */
+#if (TRC_BASE_TYPE_SIZE == 8)
+	uint32_t Padding;						/**< Aligns 64-bit parameters */
+#endif
+#else
 	uint16_t EventCount;					/**< */
 	uint32_t TS;							/**< */
+#endif
 	TraceUnsignedBaseType_t uxParams[1];	/**< */
 } TraceEvent1_t;
 
@@ -55,8 +77,19 @@ typedef struct {	/* Aligned */
  */
 typedef struct {	/* Aligned */
 	uint16_t EventID;						/**< */
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	uint16_t DTS;							/**< Timestamp delta since previous event */
+#elif (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+	uint16_t CoreID;						/**< */
+	uint32_t TS;							/**< */
+	uint32_t EventCount;					/**< */
+#if (TRC_BASE_TYPE_SIZE == 8)
+	uint32_t Padding;						/**< Aligns 64-bit parameters */
+#endif
+#else
 	uint16_t EventCount;					/**< */
 	uint32_t TS;							/**< */
+#endif
 	TraceUnsignedBaseType_t uxParams[2];	/**< */
 } TraceEvent2_t;
 
@@ -65,8 +98,19 @@ typedef struct {	/* Aligned */
  */
 typedef struct {	/* Aligned */
 	uint16_t EventID;						/**< */
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	uint16_t DTS;							/**< Timestamp delta since previous event */
+#elif (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+	uint16_t CoreID;						/**< */
+	uint32_t TS;							/**< */
+	uint32_t EventCount;					/**< */
+#if (TRC_BASE_TYPE_SIZE == 8)
+	uint32_t Padding;						/**< Aligns 64-bit parameters */
+#endif
+#else
 	uint16_t EventCount;					/**< */
 	uint32_t TS;							/**< */
+#endif
 	TraceUnsignedBaseType_t uxParams[3];	/**< */
 } TraceEvent3_t;
 
@@ -75,8 +119,19 @@ typedef struct {	/* Aligned */
  */
 typedef struct {	/* Aligned */
 	uint16_t EventID;						/**< */
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	uint16_t DTS;							/**< Timestamp delta since previous event */
+#elif (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+	uint16_t CoreID;						/**< */
+	uint32_t TS;							/**< */
+	uint32_t EventCount;					/**< */
+#if (TRC_BASE_TYPE_SIZE == 8)
+	uint32_t Padding;						/**< Aligns 64-bit parameters */
+#endif
+#else
 	uint16_t EventCount;					/**< */
 	uint32_t TS;							/**< */
+#endif
 	TraceUnsignedBaseType_t uxParams[4];	/**< */
 } TraceEvent4_t;
 
@@ -85,8 +140,19 @@ typedef struct {	/* Aligned */
  */
 typedef struct {	/* Aligned */
 	uint16_t EventID;						/**< */
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	uint16_t DTS;							/**< Timestamp delta since previous event */
+#elif (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+	uint16_t CoreID;						/**< */
+	uint32_t TS;							/**< */
+	uint32_t EventCount;					/**< */
+#if (TRC_BASE_TYPE_SIZE == 8)
+	uint32_t Padding;						/**< Aligns 64-bit parameters */
+#endif
+#else
 	uint16_t EventCount;					/**< */
 	uint32_t TS;							/**< */
+#endif
 	TraceUnsignedBaseType_t uxParams[5];	/**< */
 } TraceEvent5_t;
 
@@ -95,8 +161,19 @@ typedef struct {	/* Aligned */
  */
 typedef struct {	/* Aligned */
 	uint16_t EventID;						/**< */
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	uint16_t DTS;							/**< Timestamp delta since previous event */
+#elif (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+	uint16_t CoreID;						/**< */
+	uint32_t TS;							/**< */
+	uint32_t EventCount;					/**< */
+#if (TRC_BASE_TYPE_SIZE == 8)
+	uint32_t Padding;						/**< Aligns 64-bit parameters */
+#endif
+#else
 	uint16_t EventCount;					/**< */
 	uint32_t TS;							/**< */
+#endif
 	TraceUnsignedBaseType_t uxParams[6];	/**< */
 } TraceEvent6_t;
 
@@ -106,8 +183,20 @@ typedef struct {	/* Aligned */
 typedef struct TraceCoreEventData	/* Aligned */
 {
 	uint32_t eventCounter;										/**< */
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	uint32_t uiLastTimestamp;									/**< Timestamp that the next timestamp delta is relative to */
+	uint32_t uiLastEventCounter;								/**< Event counter of the last event that was stored */
+	uint32_t reserved;											/* alignment */
+#else
 	uint32_t reserved;											/* alignment */
-} TraceCoreEventData_t;
+#endif
+} TRC_CACHE_LINE_ALIGNED TraceCoreEventData_t;
+
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+/* Event IDs are 12 bits, the upper 4 bits of the event header ID field holds the parameter count */
+#define TRC_EVENT_FILTER_ID_COUNT (4096UL)
+#define TRC_EVENT_FILTER_WORD_COUNT ((TRC_EVENT_FILTER_ID_COUNT) / 32UL)
+#endif
 
 /** 
  * @internal Trace Event Data Table Structure.
@@ -115,8 +204,55 @@ typedef struct TraceCoreEventData	/* Aligned */
 typedef struct TraceEventDataTable	/* Aligned */
 {
 	TraceCoreEventData_t coreEventData[TRC_CFG_CORE_COUNT]; /**< Holds data about current event for each core/isr depth */
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+	uint32_t auiExcludedEvents[TRC_EVENT_FILTER_WORD_COUNT];	/**< One bit per event ID, set if the event is excluded */
+#endif
+#if (TRC_CFG_ENABLE_FRAGMENTED_EVENTS == 1)
+	uint32_t uiFragmentSequence;								/**< Sequence ID of the last payload stored in fragments */
+	uint32_t reserved;											/* alignment */
+#endif
 } TraceEventDataTable_t;
 
+/* We expose this to enable faster access */
+extern TraceEventDataTable_t* pxTraceEventDataTable;
+
+/**
+ * @brief Trace Event Fragment Structure
+ */
+typedef struct TraceEventFragment
+{
+	const void* pvData;		/**< Pointer to fragment */
+	uint32_t uiSize;		/**< Size of fragment */
+} TraceEventFragment_t;
+
+/**
+ * @brief Trace Event Reservation Structure
+ */
+typedef struct TraceEventReservation
+{
+	void* pvEvent;			/**< Pointer to reserved event */
+	uint32_t uiSize;		/**< Size of reserved event */
+} TraceEventReservation_t;
+
+/**
+ * @def TRC_EVENT_BATCH_SIZE
+ * @brief The number of bytes of events that a batch can hold. Fits an object
+ * name event and the event that follows it by default.
+ */
+#ifndef TRC_EVENT_BATCH_SIZE
+#define TRC_EVENT_BATCH_SIZE (2UL * (TRC_MAX_BLOB_SIZE))
+#endif
+
+/**
+ * @brief Trace Event Batch Structure
+ */
+typedef struct TraceEventBatch	/* Aligned */
+{
+	uint32_t uiSize;											/**< Nr of bytes added */
+	uint32_t uiEventCount;										/**< Nr of events added */
+	TraceUnsignedBaseType_t auxData[(TRC_EVENT_BATCH_SIZE) / sizeof(TraceUnsignedBaseType_t)];	/**< Events added, without event counts and timestamps */
+} TraceEventBatch_t;
+
 /**
  * @internal Initialize event trace system.
  * 
@@ -347,6 +483,161 @@ traceResult xTraceEventCreateData5(uint32_t uiEventCode, TraceUnsignedBaseType_t
  */
 traceResult xTraceEventCreateData6(uint32_t uiEventCode, TraceUnsignedBaseType_t uxParam1, TraceUnsignedBaseType_t uxParam2, TraceUnsignedBaseType_t uxParam3, TraceUnsignedBaseType_t uxParam4, TraceUnsignedBaseType_t uxParam5, TraceUnsignedBaseType_t uxParam6, const TraceUnsignedBaseType_t* const puxData, TraceUnsignedBaseType_t uxSize);
 
+/**
+ * @brief Creates an event with parameters and a payload made up of several
+ * fragments.
+ *
+ * The fragments are copied directly into the event, one after another, so
+ * a payload that is spread out in memory (e.g. a header and a body) does not
+ * have to be assembled in a temporary buffer first. The payload is padded to
+ * an aligned size and truncated like for xTraceEventCreateData1 and the like.
+ *
+ * @param[in] uiEventCode Event code.
+ * @param[in] puxParams Pointer to parameters.
+ * @param[in] uiParamCount Number of parameters.
+ * @param[in] pxFragments Pointer to payload fragments.
+ * @param[in] uiFragmentCount Number of payload fragments.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventCreateDataV(uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const TraceEventFragment_t* pxFragments, uint32_t uiFragmentCount);
+
+#if (TRC_CFG_ENABLE_FRAGMENTED_EVENTS == 1)
+
+/**
+ * The maximum number of parameters of an event created with
+ * xTraceEventCreateDataFragmented.
+ */
+#define TRC_EVENT_FRAGMENTED_MAX_PARAMS (4UL)
+
+/**
+ * The maximum number of events a payload can be split into by
+ * xTraceEventCreateDataFragmented.
+ */
+#define TRC_EVENT_FRAGMENTED_MAX_COUNT (0x10000UL)
+
+/**
+ * @brief Creates events with parameters and a payload that may be larger than
+ * TRC_MAX_BLOB_SIZE.
+ *
+ * The payload is split into as many events as needed, all with the given
+ * event code. Each event is stored on its own, so no critical section is held
+ * for the whole payload and other events may be stored in between. Every
+ * event starts with two parameters that let the host reassemble the payload:
+ * the sequence ID of the payload in the upper 16 bits and the index of the
+ * fragment in the lower 16 bits, followed by the total payload size. The given
+ * parameters follow, and then the part of the payload.
+ *
+ * If a fragment can't be stored, the rest of the payload is dropped.
+ *
+ * @param[in] uiEventCode Event code.
+ * @param[in] puxParams Pointer to parameters.
+ * @param[in] uiParamCount Number of parameters, at most TRC_EVENT_FRAGMENTED_MAX_PARAMS.
+ * @param[in] pvData Pointer to payload.
+ * @param[in] uiSize Payload size.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventCreateDataFragmented(uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const void* pvData, uint32_t uiSize);
+
+#endif
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+/**
+ * @brief Reserves an event with a payload directly in the event buffer.
+ *
+ * The payload can then be written in place, e.g. by a DMA completion handler,
+ * without being copied through a temporary buffer. The event is timestamped
+ * when it is reserved and becomes visible to the stream port when it is
+ * committed with xTraceEventCommitReservation. Since allocations are lock-free,
+ * no critical section is held in between and several reservations may be
+ * pending at the same time. Pending reservations hold back the transfer of
+ * later events, so they should be committed promptly.
+ *
+ * Only available with TRC_CFG_LOCK_FREE_ALLOCATION.
+ *
+ * @param[in] uiEventCode Event code.
+ * @param[in] uiDataSize Payload size, at most TRC_MAX_BLOB_SIZE minus the event header.
+ * @param[out] ppvData Pointer to the payload in the event buffer.
+ * @param[out] pxReservation Pointer to reservation.
+ *
+ * @retval TRC_FAIL Failure, e.g. the payload is too big, the buffer is full or the event is excluded
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventReserve(uint32_t uiEventCode, uint32_t uiDataSize, void** ppvData, TraceEventReservation_t* pxReservation);
+
+/**
+ * @brief Commits an event reserved with xTraceEventReserve.
+ *
+ * @param[in] pxReservation Pointer to reservation.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventCommitReservation(TraceEventReservation_t* pxReservation);
+#endif
+
+/**
+ * @brief Begins a batch of events.
+ *
+ * Related events that are created in a row, e.g. an object name and the
+ * creation of the object, can be added to a batch and stored together by
+ * xTraceEventBatchEnd. They then share one recorder enabled check, one
+ * critical section, one timestamp and, with stream ports that allocate from
+ * an event buffer, one allocation. The batch is usually placed on the stack.
+ *
+ * @param[out] pxBatch Pointer to batch.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventBatchBegin(TraceEventBatch_t* pxBatch);
+
+/**
+ * @brief Adds an event with parameters and a payload to a batch.
+ *
+ * Nothing is stored until xTraceEventBatchEnd is called. Events excluded by
+ * the event filter or task exclusion are not added. The payload is truncated
+ * like for xTraceEventCreateData1 and the like.
+ *
+ * @param[in] pxBatch Pointer to batch.
+ * @param[in] uiEventCode Event code.
+ * @param[in] puxParams Pointer to parameters.
+ * @param[in] uiParamCount Number of parameters.
+ * @param[in] pvData Pointer to payload, may be null if uiDataSize is 0.
+ * @param[in] uiDataSize Size of the payload.
+ *
+ * @retval TRC_FAIL The event did not fit in the batch
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventBatchAddData(TraceEventBatch_t* pxBatch, uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const void* pvData, uint32_t uiDataSize);
+
+/**
+ * @brief Adds an event with parameters to a batch.
+ *
+ * @param[in] pxBatch Pointer to batch.
+ * @param[in] uiEventCode Event code.
+ * @param[in] puxParams Pointer to parameters.
+ * @param[in] uiParamCount Number of parameters.
+ *
+ * @retval TRC_FAIL The event did not fit in the batch
+ * @retval TRC_SUCCESS Success
+ */
+#define xTraceEventBatchAdd(pxBatch, uiEventCode, puxParams, uiParamCount) xTraceEventBatchAddData(pxBatch, uiEventCode, puxParams, uiParamCount, (void*)0, 0u)
+
+/**
+ * @brief Stores the events of a batch, with consecutive event counts and
+ * the same timestamp.
+ *
+ * @param[in] pxBatch Pointer to batch.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventBatchEnd(TraceEventBatch_t* pxBatch);
+
 /**
  * @brief Gets trace event size.
  * 
@@ -358,6 +649,41 @@ traceResult xTraceEventCreateData6(uint32_t uiEventCode, TraceUnsignedBaseType_t
  */
 traceResult xTraceEventGetSize(const void* const pvAddress, uint32_t* puiSize);
 
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+
+/**
+ * @brief Excludes events with an event code from the trace.
+ *
+ * Excluded events are dropped before a critical section is entered, so this
+ * can be used to reduce the load on the stream port at runtime.
+ *
+ * @param[in] uiEventCode Event code.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventFilterExclude(uint32_t uiEventCode);
+
+/**
+ * @brief Includes events with an event code in the trace again.
+ *
+ * @param[in] uiEventCode Event code.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventFilterInclude(uint32_t uiEventCode);
+
+/**
+ * @brief Includes all events in the trace again.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventFilterIncludeAll(void);
+
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
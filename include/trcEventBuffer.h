@@ -41,6 +41,15 @@ extern "C" {
  */
 #define TRC_EVENT_BUFFER_OPTION_OVERWRITE	(1U)
 
+/**
+ * @def TRC_EVENT_BUFFER_OPTION_LOCK_FREE
+ * @brief Buffer should skip new events when full and allow allocations
+ * without a critical section. Space is reserved with an atomic
+ * compare-and-swap on uiNextHead, and uiHead is only advanced (committed)
+ * when no allocation is pending, so the consumer never sees partial events.
+ */
+#define TRC_EVENT_BUFFER_OPTION_LOCK_FREE	(2U)
+
 /**
  * @brief Trace Event Buffer Structure
  */
@@ -49,15 +58,28 @@ typedef struct TraceEventBuffer	/* Aligned */
 	uint32_t uiHead;				/**< Head index of buffer */
 	uint32_t uiTail;				/**< Tail index of buffer */
 	uint32_t uiSize;				/**< Buffer size */
-	uint32_t uiOptions;				/**< Options (skip/overwrite when full) */
+	uint32_t uiOptions;				/**< Options (skip/overwrite/lock-free) */
 	uint32_t uiDroppedEvents;		/**< Nr of dropped events */
 	uint32_t uiFree;				/**< Nr of free bytes */
 	uint32_t uiSlack;				/**< */
-	uint32_t uiNextHead;			/**< */
+	uint32_t uiNextHead;			/**< Next head, in lock-free mode also the number of pending allocations */
 	uint32_t uiTimerWraparounds;	/**< Nr of timer wraparounds */
-	uint32_t uiReserved;			/**< Reserved */
+	uint32_t uiDroppedBytes;		/**< Nr of dropped bytes */
+#if (TRC_CFG_EVENT_LOSS_RECORDS == 1)
+	uint32_t uiReportedEvents;		/**< Nr of dropped events when the last events lost record was stored */
+	uint32_t uiReportedBytes;		/**< Nr of dropped bytes when the last events lost record was stored */
+	uint32_t uiFirstDropTimestamp;	/**< Timestamp of the first event dropped since the last record */
+	uint32_t uiLastDropTimestamp;	/**< Timestamp of the last dropped event */
+#endif
+#if (TRC_CFG_ORDERED_TRANSFER == 1)
+	uint32_t uiUnorderedBytes;		/**< Nr of bytes at the tail to transfer before events are merged by timestamp */
+#endif
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+	uint32_t uiSegmentShift;		/**< Segment size as a power of two */
+	uint16_t auiSegmentFirstEvent[TRC_CFG_EVENT_BUFFER_SEGMENTS];	/**< Offset of the first event that starts in each segment, used in overwrite mode */
+#endif
 	uint8_t* puiBuffer;				/**< Trace Event Buffer: may be NULL */
-} TraceEventBuffer_t;
+} TRC_CACHE_LINE_ALIGNED TraceEventBuffer_t;
 
 /**
  * @internal Initialize trace event buffer.
@@ -66,8 +88,9 @@ typedef struct TraceEventBuffer	/* Aligned */
  * memory area based on the supplied buffer.
  * 
  * Trace event buffer options specifies the buffer behavior regarding
- * old data, the alternatives are TRC_EVENT_BUFFER_OPTION_SKIP and
- * TRC_EVENT_BUFFER_OPTION_OVERWRITE (mutual exclusive).
+ * old data, the alternatives are TRC_EVENT_BUFFER_OPTION_SKIP,
+ * TRC_EVENT_BUFFER_OPTION_OVERWRITE and TRC_EVENT_BUFFER_OPTION_LOCK_FREE
+ * (mutual exclusive).
  *
  * @param[out] pxTraceEventBuffer Pointer to uninitialized trace event buffer.
  * @param[in] uiOptions Trace event buffer options.
@@ -95,6 +118,10 @@ traceResult xTraceEventBufferAlloc(TraceEventBuffer_t *pxTraceEventBuffer, uint3
 /**
  * @brief Commits the last allocated block to the event buffer.
  *
+ * With TRC_EVENT_BUFFER_OPTION_LOCK_FREE several allocations may be pending
+ * at the same time, and the data becomes visible to the consumer when the
+ * last pending allocation is committed.
+ *
  * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
  *
  * @retval TRC_FAIL Failure
@@ -105,7 +132,9 @@ traceResult xTraceEventBufferAllocCommit(TraceEventBuffer_t *pxTraceEventBuffer,
 /**
  * @brief Pushes data into trace event buffer.
  * 
- * This routine attempts to push data into the trace event buffer.
+ * This routine attempts to push data into the trace event buffer. If the
+ * buffer skips new events and there is no room, the data is dropped and
+ * counted, and piBytesWritten is set to 0.
  *
  * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
  * @param[in] pvData Pointer to data that should be pushed into trace event buffer.
@@ -155,6 +184,19 @@ traceResult xTraceEventBufferTransferAll(TraceEventBuffer_t* pxTraceEventBuffer,
 traceResult xTraceEventBufferTransferChunk(TraceEventBuffer_t* pxTraceEventBuffer, uint32_t uiChunkSize, int32_t* piBytesWritten);
 
 
+/**
+ * @brief Gets the number of events and bytes that have been dropped since the
+ * event buffer was initialized, because there was no room for them.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ * @param[out] puiDroppedEvents Nr of dropped events.
+ * @param[out] puiDroppedBytes Nr of dropped bytes.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceEventBufferGetDropped(const TraceEventBuffer_t* pxTraceEventBuffer, uint32_t* puiDroppedEvents, uint32_t* puiDroppedBytes);
+
 /**
  * @brief Clears all data from event buffer.
  * 
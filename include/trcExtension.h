@@ -77,6 +77,10 @@ traceResult xTraceExtensionGetBaseEventId(TraceExtensionHandle_t xExtensionHandl
 /**
  * @brief Gets extension configuration name.
  *
+ * With TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE, the name is moved when the symbol
+ * arena is compacted, so it must be read in the same critical section as
+ * the call.
+ *
  * @param[in] xExtensionHandle Pointer to initialized extension handle.
  * @param[out] pszName Name.
  *
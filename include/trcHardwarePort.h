@@ -123,6 +123,8 @@ uint32_t uiTraceTimerGetValue(void);
 
 #define TRC_UNSIGNED_BASE_TYPE uint64_t
 
+#define TRC_BASE_TYPE_SIZE 8
+
 #define TRC_HWTC_TYPE TRC_FREE_RUNNING_32BIT_INCR
 #define TRC_HWTC_COUNT ((TraceUnsignedBaseType_t)uiTraceTimerGetValue())
 #define TRC_HWTC_PERIOD 0
@@ -552,9 +554,11 @@ uint32_t uiTraceTimerGetValue(void);
 	#ifdef CONFIG_64BIT
 		#define TRC_BASE_TYPE int64_t
 		#define TRC_UNSIGNED_BASE_TYPE uint64_t
+		#define TRC_BASE_TYPE_SIZE 8
 	#else
 		#define TRC_BASE_TYPE int32_t
 		#define TRC_UNSIGNED_BASE_TYPE uint32_t
+		#define TRC_BASE_TYPE_SIZE 4
 	#endif
 
 	#define TRACE_ALLOC_CRITICAL_SECTION() TraceBaseType_t TRACE_ALLOC_CRITICAL_SECTION_NAME;
@@ -805,6 +809,52 @@ uint32_t uiTraceTimerGetValue(void);
 #define TRACE_EXIT_CRITICAL_SECTION() TRC_CFG_EXIT_CRITICAL_SECTION()
 #endif
 
+/* If a custom TRC_CFG_ATOMIC_COMPARE_AND_SWAP_32 is defined it will override the default definition.
+ * It must atomically replace *puiTarget with uiDesired if *puiTarget equals uiExpected, act as a full
+ * memory barrier and evaluate to non-zero on success. */
+#ifdef TRC_CFG_ATOMIC_COMPARE_AND_SWAP_32
+#undef TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32
+#define TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(puiTarget, uiExpected, uiDesired) TRC_CFG_ATOMIC_COMPARE_AND_SWAP_32(puiTarget, uiExpected, uiDesired)
+#endif
+
+#if !defined(TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32) && (defined(__GNUC__) || defined(__clang__))
+#define TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(puiTarget, uiExpected, uiDesired) __sync_bool_compare_and_swap((puiTarget), (uiExpected), (uiDesired))
+#endif
+
+/* If a custom TRC_CFG_LOAD_ACQUIRE_32 is defined it will override the default definition.
+ * It must evaluate to *puiSource, and no memory access after it may be performed before it.
+ * Used by the event buffers when reading the index (head or tail) owned by the other side. */
+#ifdef TRC_CFG_LOAD_ACQUIRE_32
+#undef TRC_PORT_LOAD_ACQUIRE_32
+#define TRC_PORT_LOAD_ACQUIRE_32(puiSource) TRC_CFG_LOAD_ACQUIRE_32(puiSource)
+#endif
+
+/* If a custom TRC_CFG_STORE_RELEASE_32 is defined it will override the default definition.
+ * It must write uiValue to *puiTarget, and no memory access before it may be performed after it.
+ * Used by the event buffers when publishing a new head (producer) or tail (consumer). */
+#ifdef TRC_CFG_STORE_RELEASE_32
+#undef TRC_PORT_STORE_RELEASE_32
+#define TRC_PORT_STORE_RELEASE_32(puiTarget, uiValue) TRC_CFG_STORE_RELEASE_32(puiTarget, uiValue)
+#endif
+
+#if !defined(TRC_PORT_LOAD_ACQUIRE_32) && (defined(__GNUC__) || defined(__clang__))
+#define TRC_PORT_LOAD_ACQUIRE_32(puiSource) __atomic_load_n((puiSource), __ATOMIC_ACQUIRE)
+#endif
+
+#if !defined(TRC_PORT_STORE_RELEASE_32) && (defined(__GNUC__) || defined(__clang__))
+#define TRC_PORT_STORE_RELEASE_32(puiTarget, uiValue) __atomic_store_n((puiTarget), (uiValue), __ATOMIC_RELEASE)
+#endif
+
+/* Other compilers only get volatile accesses, which is enough on single core targets without data cache.
+ * Define TRC_CFG_LOAD_ACQUIRE_32 and TRC_CFG_STORE_RELEASE_32 with barriers (e.g. DMB or FENCE) otherwise. */
+#ifndef TRC_PORT_LOAD_ACQUIRE_32
+#define TRC_PORT_LOAD_ACQUIRE_32(puiSource) (*(volatile const uint32_t*)(puiSource))
+#endif
+
+#ifndef TRC_PORT_STORE_RELEASE_32
+#define TRC_PORT_STORE_RELEASE_32(puiTarget, uiValue) (*(volatile uint32_t*)(puiTarget) = (uiValue))
+#endif
+
 #ifndef TRACE_ALLOC_CRITICAL_SECTION
 #define TRACE_ALLOC_CRITICAL_SECTION() TRC_KERNEL_PORT_ALLOC_CRITICAL_SECTION()
 #endif
@@ -37,7 +37,7 @@ typedef struct TraceISRCoreData	/* Aligned */
 	TraceISRHandle_t handleStack[TRC_CFG_MAX_ISR_NESTING];	/**< */
 	int32_t stackIndex;										/**< */
 	uint32_t isPendingContextSwitch;							/**< */
-} TraceISRCoreData_t;
+} TRC_CACHE_LINE_ALIGNED TraceISRCoreData_t;
 
 /**
  * @internal Trace ISR Data Structure
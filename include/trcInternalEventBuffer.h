@@ -162,6 +162,17 @@ traceResult xTraceInternalEventBufferTransferChunk(void);
  */
 traceResult xTraceInternalEventBufferClear(void);
 
+/**
+ * @brief Marks the data in the internal trace event buffer as unordered, so
+ * that it is transferred before any events are merged by timestamp.
+ *
+ * Only has an effect when TRC_CFG_ORDERED_TRANSFER is 1.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceInternalEventBufferMarkUnordered(void);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -177,6 +188,7 @@ traceResult xTraceInternalEventBufferClear(void);
 #define xTraceInternalEventBufferTransfer() (void)(TRC_SUCCESS)
 #define xTraceInternalEventBufferTransferChunk(piBytesWritten, uiChunkSize) ((void)(piBytesWritten), (void)(uiChunkSize), TRC_SUCCESS)
 #define xTraceInternalEventBufferClear() (void)(TRC_SUCCESS)
+#define xTraceInternalEventBufferMarkUnordered() (void)(TRC_SUCCESS)
 
 #endif /* (TRC_USE_INTERNAL_BUFFER == 1)*/
 
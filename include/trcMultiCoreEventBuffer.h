@@ -44,8 +44,9 @@ typedef struct TraceMultiCoreEventBuffer	/* Aligned */
  * a memory area based on the supplied buffer.
  * 
  * Trace event buffer options specifies the buffer behavior regarding
- * old data, the alternatives are TRC_EVENT_BUFFER_OPTION_SKIP and
- * TRC_EVENT_BUFFER_OPTION_OVERWRITE (mutal exclusive).
+ * old data, the alternatives are TRC_EVENT_BUFFER_OPTION_SKIP,
+ * TRC_EVENT_BUFFER_OPTION_OVERWRITE and TRC_EVENT_BUFFER_OPTION_LOCK_FREE
+ * (mutal exclusive).
  * 
  * @param[out] pxTraceMultiCoreEventBuffer Pointer to unitialized multi-core trace event buffer.
  * @param[in] uiOptions Trace event buffer options.
@@ -118,6 +119,24 @@ traceResult xTraceMultiCoreEventBufferPush(const TraceMultiCoreEventBuffer_t* co
  */
 #define xTraceMultiCoreEventBufferAlloc(pxTraceMultiCoreEventBuffer, uiSize, ppvData) xTraceEventBufferAlloc((pxTraceMultiCoreEventBuffer)->xEventBuffer[TRC_CFG_GET_CURRENT_CORE()], uiSize, ppvData)
 
+#if ((TRC_CFG_LOCK_FREE_ALLOCATION) == 1) && ((TRC_CFG_CORE_COUNT) > 1)
+/**
+ * @brief Commits the last allocated block to the event buffer.
+ *
+ * Without a critical section the caller may have migrated to another core
+ * since the allocation, so the commit is made to the core event buffer that
+ * holds pvData.
+ *
+ * @param[in] pxTraceMultiCoreEventBuffer Pointer to initialized multi-core trace event buffer.
+ * @param[in] pvData Data pointer.
+ * @param[in] uiSize Data size.
+ * @param piBytesWritten The number of bytes that was written.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceMultiCoreEventBufferAllocCommit(const TraceMultiCoreEventBuffer_t * const pxTraceMultiCoreEventBuffer, void *pvData, uint32_t uiSize, int32_t *piBytesWritten);
+#else
 /**
  * @brief Commits the last allocated block to the event buffer.
  *
@@ -127,6 +146,7 @@ traceResult xTraceMultiCoreEventBufferPush(const TraceMultiCoreEventBuffer_t* co
  * @retval TRC_SUCCESS Success
  */
 #define xTraceMultiCoreEventBufferAllocCommit(pxTraceMultiCoreEventBuffer, pvData, uiSize, piBytesWritten) xTraceEventBufferAllocCommit((pxTraceMultiCoreEventBuffer)->xEventBuffer[TRC_CFG_GET_CURRENT_CORE()], pvData, uiSize, piBytesWritten)
+#endif
 
 /**
  * @brief Pushes data into multi-core trace event buffer.
@@ -188,6 +208,24 @@ traceResult xTraceMultiCoreEventBufferTransferChunk(const TraceMultiCoreEventBuf
  */
 traceResult xTraceMultiCoreEventBufferClear(const TraceMultiCoreEventBuffer_t* const pxTraceMultiCoreEventBuffer);
 
+#if (TRC_CFG_ORDERED_TRANSFER == 1)
+/**
+ * @brief Marks the data stored so far on the current core as unordered.
+ *
+ * Unordered data, e.g. the trace header and the entry table, has no event
+ * timestamps. It is transferred as is, before any events are merged by
+ * timestamp.
+ *
+ * @param[in] pxTraceMultiCoreEventBuffer Pointer to initialized multi-core trace event buffer.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceMultiCoreEventBufferMarkUnordered(const TraceMultiCoreEventBuffer_t* const pxTraceMultiCoreEventBuffer);
+#else
+#define xTraceMultiCoreEventBufferMarkUnordered(pxTraceMultiCoreEventBuffer) ((void)(pxTraceMultiCoreEventBuffer), TRC_SUCCESS)
+#endif
+
 /** @} */
 
 #ifdef __cplusplus
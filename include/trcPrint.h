@@ -411,6 +411,163 @@ traceResult xTracePrintF(TraceStringHandle_t xChannel, const char* szFormat, ...
  */
 traceResult xTraceVPrintF(TraceStringHandle_t xChannel, const char* szFormat, va_list* pxVariableList);
 
+/**
+ * @brief Generates "User Events" with formatted text and data, with a known
+ * number of arguments and format string length.
+ *
+ * Same as xTracePrintF(), but the format string is not scanned to find the
+ * number of arguments and its length. Usually called through
+ * xTracePrintLiteralF(), which finds both at compile time.
+ *
+ * @param[in] xChannel Channel.
+ * @param[in] szFormat Format.
+ * @param[in] uiLength Length of the format string, including null termination.
+ * @param[in] uiArgs Number of arguments, at most 5.
+ * @param[in] puxArgs Pointer to arguments.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTracePrintFArgs(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, uint32_t uiArgs, const TraceUnsignedBaseType_t* puxArgs);
+
+/**
+ * @brief Same as xTracePrintFArgs() with 1 argument, passed by value.
+ *
+ * Lets xTracePrintLiteralF() pass its arguments without building an array,
+ * which also works when the header is included from C++.
+ *
+ * @param[in] xChannel Channel.
+ * @param[in] szFormat Format.
+ * @param[in] uiLength Length of the format string, including null termination.
+ * @param[in] uxParam1 First argument.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTracePrintFArgs1(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1);
+
+/**
+ * @brief Same as xTracePrintFArgs() with 2 arguments, passed by value.
+ *
+ * @param[in] xChannel Channel.
+ * @param[in] szFormat Format.
+ * @param[in] uiLength Length of the format string, including null termination.
+ * @param[in] uxParam1 First argument.
+ * @param[in] uxParam2 Second argument.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTracePrintFArgs2(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1, TraceUnsignedBaseType_t uxParam2);
+
+/**
+ * @brief Same as xTracePrintFArgs() with 3 arguments, passed by value.
+ *
+ * @param[in] xChannel Channel.
+ * @param[in] szFormat Format.
+ * @param[in] uiLength Length of the format string, including null termination.
+ * @param[in] uxParam1 First argument.
+ * @param[in] uxParam2 Second argument.
+ * @param[in] uxParam3 Third argument.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTracePrintFArgs3(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1, TraceUnsignedBaseType_t uxParam2, TraceUnsignedBaseType_t uxParam3);
+
+/**
+ * @brief Same as xTracePrintFArgs() with 4 arguments, passed by value.
+ *
+ * @param[in] xChannel Channel.
+ * @param[in] szFormat Format.
+ * @param[in] uiLength Length of the format string, including null termination.
+ * @param[in] uxParam1 First argument.
+ * @param[in] uxParam2 Second argument.
+ * @param[in] uxParam3 Third argument.
+ * @param[in] uxParam4 Fourth argument.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTracePrintFArgs4(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1, TraceUnsignedBaseType_t uxParam2, TraceUnsignedBaseType_t uxParam3, TraceUnsignedBaseType_t uxParam4);
+
+/**
+ * @brief Same as xTracePrintFArgs() with 5 arguments, passed by value.
+ *
+ * @param[in] xChannel Channel.
+ * @param[in] szFormat Format.
+ * @param[in] uiLength Length of the format string, including null termination.
+ * @param[in] uxParam1 First argument.
+ * @param[in] uxParam2 Second argument.
+ * @param[in] uxParam3 Third argument.
+ * @param[in] uxParam4 Fourth argument.
+ * @param[in] uxParam5 Fifth argument.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTracePrintFArgs5(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1, TraceUnsignedBaseType_t uxParam2, TraceUnsignedBaseType_t uxParam3, TraceUnsignedBaseType_t uxParam4, TraceUnsignedBaseType_t uxParam5);
+
+/**
+ * @internal Macro helpers for counting the arguments after a format string.
+ */
+#define TRC_PRINT_ARG_COUNT(...) TRC_PRINT_ARG_COUNT_HELPER(__VA_ARGS__, 5, 4, 3, 2, 1, 0, 0)
+#define TRC_PRINT_ARG_COUNT_HELPER(_f, _1, _2, _3, _4, _5, _n, ...) _n
+#define TRC_PRINT_CONCAT(_a, _b) TRC_PRINT_CONCAT_HELPER(_a, _b)
+#define TRC_PRINT_CONCAT_HELPER(_a, _b) _a##_b
+
+/**
+ * @internal Macro helpers for xTracePrintLiteralF. The format string must be a
+ * string literal, which lets sizeof give its length including null termination.
+ */
+#define TRC_PRINT_LITERAL_F0(_c, _f) xTracePrintFArgs(_c, _f, (uint32_t)sizeof("" _f), 0u, (const TraceUnsignedBaseType_t*)0)
+#define TRC_PRINT_LITERAL_F1(_c, _f, _p1) xTracePrintFArgs1(_c, _f, (uint32_t)sizeof("" _f), (TraceUnsignedBaseType_t)(_p1))
+#define TRC_PRINT_LITERAL_F2(_c, _f, _p1, _p2) xTracePrintFArgs2(_c, _f, (uint32_t)sizeof("" _f), (TraceUnsignedBaseType_t)(_p1), (TraceUnsignedBaseType_t)(_p2))
+#define TRC_PRINT_LITERAL_F3(_c, _f, _p1, _p2, _p3) xTracePrintFArgs3(_c, _f, (uint32_t)sizeof("" _f), (TraceUnsignedBaseType_t)(_p1), (TraceUnsignedBaseType_t)(_p2), (TraceUnsignedBaseType_t)(_p3))
+#define TRC_PRINT_LITERAL_F4(_c, _f, _p1, _p2, _p3, _p4) xTracePrintFArgs4(_c, _f, (uint32_t)sizeof("" _f), (TraceUnsignedBaseType_t)(_p1), (TraceUnsignedBaseType_t)(_p2), (TraceUnsignedBaseType_t)(_p3), (TraceUnsignedBaseType_t)(_p4))
+#define TRC_PRINT_LITERAL_F5(_c, _f, _p1, _p2, _p3, _p4, _p5) xTracePrintFArgs5(_c, _f, (uint32_t)sizeof("" _f), (TraceUnsignedBaseType_t)(_p1), (TraceUnsignedBaseType_t)(_p2), (TraceUnsignedBaseType_t)(_p3), (TraceUnsignedBaseType_t)(_p4), (TraceUnsignedBaseType_t)(_p5))
+
+/**
+ * @brief Generates "User Events" with formatted text and data, without
+ * scanning the format string.
+ *
+ * Same as xTracePrintF(), but the number of arguments and the length of the
+ * format string are found at compile time. The format string must be a string
+ * literal and there can be at most 5 arguments. The number of arguments must
+ * match the format string, since it is not checked.
+ * Every argument is stored as one TraceUnsignedBaseType_t, so %lld and %f
+ * arguments are not supported even if TRC_CFG_PRINT_TYPED_ARGUMENTS is 1.
+ *
+ * Example:
+ *	 xTracePrintLiteralF(adc_uechannel, "ADC channel %d: %d volts", ch, adc_reading);
+ *
+ * @param[in] xChannel Channel.
+ * @param[in] ... Format string literal, followed by parameters.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+#define xTracePrintLiteralF(xChannel, ...) TRC_PRINT_CONCAT(TRC_PRINT_LITERAL_F, TRC_PRINT_ARG_COUNT(__VA_ARGS__))(xChannel, __VA_ARGS__)
+
+/**
+ * @brief Generate a "User Event" with xTracePrintCompactF0 to
+ * xTracePrintCompactF4, picked by the number of parameters.
+ *
+ * Same as xTracePrintCompactF(), but the number of parameters is found at
+ * compile time instead of by scanning the format string. The format string
+ * must be a string literal and there can be at most 4 parameters.
+ *
+ * Example:
+ *	xTracePrintCompactLiteralF("MyChannel", "MyFormat %d", 1);
+ *
+ * @param[in] szChannel Channel string.
+ * @param[in] ... Format string literal, followed by parameters.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+#define xTracePrintCompactLiteralF(szChannel, ...) TRC_PRINT_CONCAT(xTracePrintCompactF, TRC_PRINT_ARG_COUNT(__VA_ARGS__))(szChannel, __VA_ARGS__)
+
 /** @} */
 
 #ifdef __cplusplus
@@ -434,6 +591,18 @@ typedef struct TracePrintData
 
 #define xTraceVPrintF(_c, _s, _v) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_4((void)(_c), (void)(_s), (void)(_v), TRC_SUCCESS)
 
+#define xTracePrintFArgs(_c, _s, _l, _n, _p) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_6((void)(_c), (void)(_s), (void)(_l), (void)(_n), (void)(_p), TRC_SUCCESS)
+
+#define xTracePrintFArgs1(_c, _s, _l, _p1) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_5((void)(_c), (void)(_s), (void)(_l), (void)(_p1), TRC_SUCCESS)
+#define xTracePrintFArgs2(_c, _s, _l, _p1, _p2) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_6((void)(_c), (void)(_s), (void)(_l), (void)(_p1), (void)(_p2), TRC_SUCCESS)
+#define xTracePrintFArgs3(_c, _s, _l, _p1, _p2, _p3) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_7((void)(_c), (void)(_s), (void)(_l), (void)(_p1), (void)(_p2), (void)(_p3), TRC_SUCCESS)
+#define xTracePrintFArgs4(_c, _s, _l, _p1, _p2, _p3, _p4) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_8((void)(_c), (void)(_s), (void)(_l), (void)(_p1), (void)(_p2), (void)(_p3), (void)(_p4), TRC_SUCCESS)
+#define xTracePrintFArgs5(_c, _s, _l, _p1, _p2, _p3, _p4, _p5) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_9((void)(_c), (void)(_s), (void)(_l), (void)(_p1), (void)(_p2), (void)(_p3), (void)(_p4), (void)(_p5), TRC_SUCCESS)
+
+#define xTracePrintLiteralF(_c, ...) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)(_c), TRC_SUCCESS)
+
+#define xTracePrintCompactLiteralF(_c, ...) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)(_c), TRC_SUCCESS)
+
 #define xTracePrintF0(_c, _f) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)(_c), (void)(_f), TRC_SUCCESS)
 #define xTracePrintF1(_c, _f, _p1) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_4((void)(_c), (void)(_f), (void)(_p1), TRC_SUCCESS)
 #define xTracePrintF2(_c, _f, _p1, _p2) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_5((void)(_c), (void)(_f), (void)(_p1), (void)(_p2), TRC_SUCCESS)
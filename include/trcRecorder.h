@@ -113,6 +113,124 @@ typedef uint8_t traceHandle;
 #define TRC_CFG_USE_GCC_STATEMENT_EXPR 0
 #endif
 
+/* Unless specified in trcStreamingConfig.h events are allocated inside a critical section */
+#ifndef TRC_CFG_LOCK_FREE_ALLOCATION
+#define TRC_CFG_LOCK_FREE_ALLOCATION 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h object name and create events are stored one at a time */
+#ifndef TRC_CFG_OBJECT_REGISTER_BATCH
+#define TRC_CFG_OBJECT_REGISTER_BATCH 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h events can't be filtered at runtime */
+#ifndef TRC_CFG_ENABLE_EVENT_FILTER
+#define TRC_CFG_ENABLE_EVENT_FILTER 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h payloads can't be split into fragmented events */
+#ifndef TRC_CFG_ENABLE_FRAGMENTED_EVENTS
+#define TRC_CFG_ENABLE_FRAGMENTED_EVENTS 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h tasks can't be excluded */
+#ifndef TRC_CFG_ENABLE_TASK_EXCLUSION
+#define TRC_CFG_ENABLE_TASK_EXCLUSION 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h events use the full event header */
+#ifndef TRC_CFG_COMPACT_EVENT_HEADER
+#define TRC_CFG_COMPACT_EVENT_HEADER 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h events have the 8 byte header with a 4-bit core ID and 12-bit event count */
+#ifndef TRC_CFG_EXTENDED_EVENT_HEADER
+#define TRC_CFG_EXTENDED_EVENT_HEADER 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h every entry has a fixed-size symbol slot */
+#ifndef TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE
+#define TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h entries are found by scanning the entry table */
+#ifndef TRC_CFG_ENTRY_HASH_INDEX
+#define TRC_CFG_ENTRY_HASH_INDEX 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h entry slots are taken and given in a critical section */
+#ifndef TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION
+#define TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h the entry table is sent all at once when tracing starts */
+#ifndef TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE
+#define TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h the entry table has a fixed size */
+#ifndef TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS
+#define TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h the entry table can grow by at most 4 segments */
+#ifndef TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS
+#define TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS 4
+#endif
+
+/* Unless specified in trcStreamingConfig.h every registered string gets its own entry */
+#ifndef TRC_CFG_STRING_INTERN_SLOTS
+#define TRC_CFG_STRING_INTERN_SLOTS 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h lost events are only counted */
+#ifndef TRC_CFG_EVENT_LOSS_RECORDS
+#define TRC_CFG_EVENT_LOSS_RECORDS 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h event buffers can have any size */
+#ifndef TRC_CFG_EVENT_BUFFER_POWER_OF_TWO
+#define TRC_CFG_EVENT_BUFFER_POWER_OF_TWO 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h the event buffers of the cores are transferred one at a time */
+#ifndef TRC_CFG_ORDERED_TRANSFER
+#define TRC_CFG_ORDERED_TRANSFER 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h overwritten events are freed one at a time */
+#ifndef TRC_CFG_EVENT_BUFFER_SEGMENTS
+#define TRC_CFG_EVENT_BUFFER_SEGMENTS 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h xTracePrintF sends the whole format string every time */
+#ifndef TRC_CFG_PRINT_INTERN_FORMAT_STRINGS
+#define TRC_CFG_PRINT_INTERN_FORMAT_STRINGS 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h xTracePrintF stores every argument as one TraceUnsignedBaseType_t */
+#ifndef TRC_CFG_PRINT_TYPED_ARGUMENTS
+#define TRC_CFG_PRINT_TYPED_ARGUMENTS 0
+#endif
+
+/* Unless specified in trcStreamingConfig.h the per-core recorder state is packed together */
+#ifndef TRC_CFG_CACHE_LINE_SIZE
+#define TRC_CFG_CACHE_LINE_SIZE 0
+#endif
+
+/* Aligns and pads the per-core recorder state types to the cache line size */
+#if (TRC_CFG_CACHE_LINE_SIZE > 0)
+#if defined(TRC_CFG_CACHE_LINE_ALIGNED)
+#define TRC_CACHE_LINE_ALIGNED TRC_CFG_CACHE_LINE_ALIGNED
+#elif defined(__GNUC__) || defined(__clang__)
+#define TRC_CACHE_LINE_ALIGNED __attribute__((aligned(TRC_CFG_CACHE_LINE_SIZE)))
+#else
+#error "TRC_CFG_CACHE_LINE_SIZE requires TRC_CFG_CACHE_LINE_ALIGNED to be defined in trcConfig.h for this compiler"
+#endif
+#else
+#define TRC_CACHE_LINE_ALIGNED
+#endif
+
 /* Backwards compatibility */
 #undef traceHandle
 #define traceHandle TraceISRHandle_t
@@ -164,6 +282,7 @@ typedef struct TraceHeaderBuffer	/* Aligned */
 #include <trcInterval.h>
 #include <trcStateMachine.h>
 #include <trcCounter.h>
+#include <trcDataChannel.h>
 
 #if (TRC_USE_TRACEALYZER_RECORDER == 1)
 
@@ -1623,11 +1742,17 @@ typedef RecorderDataType TraceRecorderData_t;
 #define TRC_EXTERNAL_BUFFERS 0
 #endif
 
+/* The system state of a core, on a cache line of its own if TRC_CFG_CACHE_LINE_SIZE is set */
+typedef struct TraceSystemState	/* Aligned */
+{
+	TraceUnsignedBaseType_t uxSystemState;
+} TRC_CACHE_LINE_ALIGNED TraceSystemState_t;
+
 typedef struct TraceRecorderData	/* Aligned */
 {
 	uint32_t uiSessionCounter;
 	uint32_t uiRecorderEnabled;
-	TraceUnsignedBaseType_t uxTraceSystemStates[TRC_CFG_CORE_COUNT];
+	TraceSystemState_t uxTraceSystemStates[TRC_CFG_CORE_COUNT];
 	uint32_t reserved;								/* alignment */
 
 	TraceAssertData_t xAssertBuffer;				/* aligned */
@@ -1649,6 +1774,7 @@ typedef struct TraceRecorderData	/* Aligned */
 	TraceDiagnosticsData_t xDiagnosticsBuffer;		/* aligned */
 	TraceExtensionData_t xExtensionBuffer;			/* aligned */
 	TraceCounterData_t xCounterBuffer;				/* aligned */
+	TraceStringData_t xStringBuffer;				/* aligned */
 } TraceRecorderData_t;
 
 extern TraceRecorderData_t* pxTraceRecorderData;
@@ -1708,7 +1834,7 @@ traceResult xTraceHeaderInitialize(TraceHeaderBuffer_t* pxBuffer);
  * @retval TRC_FAIL Failure
  * @retval TRC_SUCCESS Success
  */
-#define xTraceStateSet(uxState) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(pxTraceRecorderData->uxTraceSystemStates[TRC_CFG_GET_CURRENT_CORE()] = (uxState), TRC_SUCCESS)
+#define xTraceStateSet(uxState) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(pxTraceRecorderData->uxTraceSystemStates[TRC_CFG_GET_CURRENT_CORE()].uxSystemState = (uxState), TRC_SUCCESS)
 
 /**
  * @brief Query the trace state
@@ -1718,7 +1844,7 @@ traceResult xTraceHeaderInitialize(TraceHeaderBuffer_t* pxBuffer);
  * @retval TRC_FAIL Failure
  * @retval TRC_SUCCESS Success
  */
-#define xTraceStateGet(puxState) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(*(puxState) = pxTraceRecorderData->uxTraceSystemStates[TRC_CFG_GET_CURRENT_CORE()], TRC_SUCCESS)
+#define xTraceStateGet(puxState) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(*(puxState) = pxTraceRecorderData->uxTraceSystemStates[TRC_CFG_GET_CURRENT_CORE()].uxSystemState, TRC_SUCCESS)
 
 /**
  * @brief Call this function periodically
@@ -1869,6 +1995,10 @@ traceResult xTraceGetEventBuffer(void** ppvBuffer, TraceUnsignedBaseType_t * pui
 #define vTraceSetFilterGroup(x) (void)(x)
 #define vTraceSetFilterMask(x) (void)(x)
 
+#define xTraceEventFilterExclude(_uiEventCode) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)(_uiEventCode), TRC_SUCCESS)
+#define xTraceEventFilterInclude(_uiEventCode) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)(_uiEventCode), TRC_SUCCESS)
+#define xTraceEventFilterIncludeAll() (TRC_SUCCESS)
+
 #define prvTraceSetReadyEventsEnabled(status) (void)(status)
 
 #define vTraceExcludeTask(handle) (void)(handle)
@@ -29,11 +29,40 @@ extern "C" {
  * @{
  */
 
+#if (TRC_CFG_STRING_INTERN_SLOTS > 0)
+
+typedef struct TraceStringData	/* Aligned */
+{
+	TraceStringHandle_t axInternTable[TRC_CFG_STRING_INTERN_SLOTS];	/* Registered strings by hash of the string text, 0 if empty */
+} TraceStringData_t;
+
+/**
+ * @internal Initializes the string trace system.
+ * 
+ * @param[in] pxBuffer Pointer to memory that is used by the string trace system.
+ * 
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceStringInitialize(TraceStringData_t *pxBuffer);
+
+#else
+
+typedef struct TraceStringData
+{
+	uint32_t buffer[1];
+} TraceStringData_t;
+
+#define xTraceStringInitialize(__pxBuffer) ((void)(__pxBuffer), TRC_SUCCESS)
+
+#endif
+
 /**
  * @brief Registers a trace string.
  * 
  * This routine registers a strings in the recorder, e.g. for names of user
- * event channels.
+ * event channels. With TRC_CFG_STRING_INTERN_SLOTS, registering a string
+ * that is already registered returns the existing handle.
  *
  * Example:
  *	 TraceStringHandle_t myEventHandle;
@@ -39,10 +39,23 @@ extern "C" {
 typedef struct TraceTaskData	/* Aligned */
 {
 	void* coreTasks[TRC_CFG_CORE_COUNT];
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+	TraceUnsignedBaseType_t coreTasksExcluded[TRC_CFG_CORE_COUNT];	/* Set if the current task on the core is excluded */
+	TraceUnsignedBaseType_t uxExcludedCount;						/* Entry lookups on task switches are skipped while this is 0 */
+#endif
 } TraceTaskData_t;
 
 extern TraceTaskData_t* pxTraceTaskData;
 
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+/**
+ * @internal Includes a task that is unregistered, so it is no longer counted as excluded.
+ */
+#define TRC_TASK_CLEAR_EXCLUDED(pvTask) ((pxTraceTaskData->uxExcludedCount != 0u) ? (void)xTraceTaskInclude(pvTask) : (void)0)
+#else
+#define TRC_TASK_CLEAR_EXCLUDED(pvTask) ((void)0)
+#endif
+
 /**
  * @internal Initialize trace task system.
  * 
@@ -76,7 +89,7 @@ traceResult xTraceTaskInitialize(TraceTaskData_t* pxBuffer);
  * @retval TRC_FAIL Failure
  * @retval TRC_SUCCESS Success
  */
-#define xTraceTaskUnregister(xTaskHandle, uxPriority) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)xTraceStackMonitorRemove(xTraceEntryGetAddressReturn((TraceEntryHandle_t)(xTaskHandle))), xTraceObjectUnregister((TraceObjectHandle_t)(xTaskHandle), PSF_EVENT_TASK_DELETE, uxPriority))
+#define xTraceTaskUnregister(xTaskHandle, uxPriority) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)xTraceStackMonitorRemove(xTraceEntryGetAddressReturn((TraceEntryHandle_t)(xTaskHandle))), TRC_TASK_CLEAR_EXCLUDED(xTraceEntryGetAddressReturn((TraceEntryHandle_t)(xTaskHandle))), xTraceObjectUnregister((TraceObjectHandle_t)(xTaskHandle), PSF_EVENT_TASK_DELETE, uxPriority))
 
 /**
  * @brief Sets trace task name. 
@@ -121,7 +134,7 @@ traceResult xTraceTaskSetPriority(TraceTaskHandle_t xTaskHandle, TraceUnsignedBa
  * @retval TRC_FAIL Failure
  * @retval TRC_SUCCESS Success
  */
-#define xTraceTaskUnregisterWithoutHandle(pvTask, uxPriority) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)xTraceStackMonitorRemove(pvTask), xTraceObjectUnregisterWithoutHandle(PSF_EVENT_TASK_DELETE, pvTask, uxPriority))
+#define xTraceTaskUnregisterWithoutHandle(pvTask, uxPriority) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)xTraceStackMonitorRemove(pvTask), TRC_TASK_CLEAR_EXCLUDED(pvTask), xTraceObjectUnregisterWithoutHandle(PSF_EVENT_TASK_DELETE, pvTask, uxPriority))
 
 /**
  * @brief Sets trace task name without trace task handle.
@@ -145,6 +158,47 @@ traceResult xTraceTaskSetPriority(TraceTaskHandle_t xTaskHandle, TraceUnsignedBa
  */
 traceResult xTraceTaskSetPriorityWithoutHandle(void* pvTask, TraceUnsignedBaseType_t uxPriority);
 
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+
+/**
+ * @brief Excludes the events of a task from the trace.
+ *
+ * Events created while the task is running are dropped, except for the task
+ * switches to it. Events from ISRs that interrupt the task are still stored.
+ * The task must have been registered.
+ *
+ * @param[in] pvTask Task.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceTaskExclude(void* pvTask);
+
+/**
+ * @brief Includes the events of a previously excluded task in the trace again.
+ *
+ * @param[in] pvTask Task.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+traceResult xTraceTaskInclude(void* pvTask);
+
+/**
+ * @brief Returns non-zero if the current task on this core is excluded.
+ *
+ * @returns Non-zero if excluded.
+ */
+#define xTraceTaskIsCurrentExcluded() (pxTraceTaskData->coreTasksExcluded[TRC_CFG_GET_CURRENT_CORE()])
+
+#define vTraceExcludeTask(pvTask) (void)xTraceTaskExclude(pvTask)
+
+#else
+
+#define vTraceExcludeTask(pvTask) (void)(pvTask)
+
+#endif
+
 /**
  * @brief Registers trace task switch event.
  * 
@@ -271,6 +325,10 @@ traceResult xTraceTaskSwitch(void* pvTask, TraceUnsignedBaseType_t uxPriority);
 
 #define xTraceTaskSetPriorityWithoutHandle(__pvTask, __uxPriority) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)(__pvTask), (void)(__uxPriority), TRC_SUCCESS)
 
+#define xTraceTaskExclude(__pvTask) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)(__pvTask), TRC_SUCCESS)
+
+#define xTraceTaskInclude(__pvTask) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)(__pvTask), TRC_SUCCESS)
+
 #define xTraceTaskSwitch(__pvTask, __uxPriority) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_3((void)(__pvTask), (void)(__uxPriority), TRC_SUCCESS)
 
 #define xTraceTaskReady(__pvTask) TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2((void)(__pvTask), TRC_SUCCESS)
@@ -27,6 +27,12 @@ extern "C" {
 #define TRC_UNSIGNED_BASE_TYPE uint32_t
 #endif
 
+/* The size of TRC_UNSIGNED_BASE_TYPE in bytes, for checks made by the preprocessor.
+ * Ports with a base type other than 32-bit must define it. */
+#ifndef TRC_BASE_TYPE_SIZE
+#define TRC_BASE_TYPE_SIZE 4
+#endif
+
 typedef TRC_UNSIGNED_BASE_TYPE TraceUnsignedBaseType_t;
 
 typedef TRC_BASE_TYPE TraceBaseType_t;
@@ -75,6 +81,8 @@ typedef TraceHandleBaseType_t TraceProcessHandle_t;
 
 typedef TraceHandleBaseType_t TraceThreadHandle_t;
 
+typedef TraceHandleBaseType_t TraceDataChannelHandle_t;
+
 typedef void (*TraceCounterCallback_t)(TraceCounterHandle_t xCounterHandle);
 
 /* DEPRECATED. Backwards compatibility */
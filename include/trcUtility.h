@@ -47,6 +47,7 @@
 	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_6(e1, e2, e3, e4, e5, e6)			__extension__({e1; e2; e3; e4; e5; e6;})
 	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_7(e1, e2, e3, e4, e5, e6, e7)		__extension__({e1; e2; e3; e4; e5; e6; e7;})
 	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_8(e1, e2, e3, e4, e5, e6, e7, e8)	__extension__({e1; e2; e3; e4; e5; e6; e7; e8;})
+	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_9(e1, e2, e3, e4, e5, e6, e7, e8, e9)	__extension__({e1; e2; e3; e4; e5; e6; e7; e8; e9;})
 #else
 	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_1(e1)								(e1)
 	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_2(e1, e2)							(e1, e2)
@@ -56,6 +57,7 @@
 	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_6(e1, e2, e3, e4, e5, e6)			(e1, e2, e3, e4, e5, e6)
 	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_7(e1, e2, e3, e4, e5, e6, e7)		(e1, e2, e3, e4, e5, e6, e7)
 	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_8(e1, e2, e3, e4, e5, e6, e7, e8)	(e1, e2, e3, e4, e5, e6, e7, e8)
+	#define TRC_COMMA_EXPR_TO_STATEMENT_EXPR_9(e1, e2, e3, e4, e5, e6, e7, e8, e9)	(e1, e2, e3, e4, e5, e6, e7, e8, e9)
 #endif
 
 #endif /* TRC_UTILITY_H */
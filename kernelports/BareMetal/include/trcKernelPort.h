@@ -141,6 +141,8 @@ traceResult xTraceKernelPortEnable(void);
 #define PSF_EVENT_OBJ_NAME									0x03UL
 #define PSF_EVENT_TASK_PRIORITY								0x04UL
 #define PSF_EVENT_DEFINE_ISR								0x05UL
+#define PSF_EVENT_EVENTS_LOST								0x0EUL
+#define PSF_EVENT_TS_EXTENSION								0x0FUL
 
 #define PSF_EVENT_IFE_NEXT									0x08UL
 #define PSF_EVENT_IFE_DIRECT								0x09UL
@@ -152,6 +154,9 @@ traceResult xTraceKernelPortEnable(void);
 #define PSF_EVENT_THREAD_CREATE								0x14UL
 #define PSF_EVENT_THREAD_DELETE								0x15UL
 
+/* Object creates and deletes, which are kept when the current task is excluded (TRC_CFG_ENABLE_TASK_EXCLUSION) */
+#define TRC_KERNEL_PORT_IS_OBJECT_EVENT(uiEventCode) (((uint32_t)(uiEventCode) >= 0x10UL) && ((uint32_t)(uiEventCode) <= 0x1FUL))
+
 #define PSF_EVENT_TASK_READY								0x20UL
 #define PSF_EVENT_ISR_BEGIN									0x21UL
 #define PSF_EVENT_ISR_RESUME								0x22UL
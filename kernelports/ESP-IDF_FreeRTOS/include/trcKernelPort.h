@@ -407,6 +407,8 @@ TraceHeapHandle_t xTraceKernelPortGetSystemHeapHandle(void);
 #define PSF_EVENT_TASK_PRIO_INHERIT							0x05
 #define PSF_EVENT_TASK_PRIO_DISINHERIT						0x06
 #define PSF_EVENT_DEFINE_ISR								0x07
+#define PSF_EVENT_EVENTS_LOST								0x0E
+#define PSF_EVENT_TS_EXTENSION								0x0F
 
 #define PSF_EVENT_TASK_CREATE								0x10
 #define PSF_EVENT_QUEUE_CREATE								0x11
@@ -428,6 +430,9 @@ TraceHeapHandle_t xTraceKernelPortGetSystemHeapHandle(void);
 #define PSF_EVENT_STREAMBUFFER_DELETE						0x28
 #define PSF_EVENT_MESSAGEBUFFER_DELETE						0x29
 
+/* Object creates and deletes, which are kept when the current task is excluded (TRC_CFG_ENABLE_TASK_EXCLUSION) */
+#define TRC_KERNEL_PORT_IS_OBJECT_EVENT(uiEventCode) (((uint32_t)(uiEventCode) >= 0x10UL) && ((uint32_t)(uiEventCode) <= 0x2FUL))
+
 #define PSF_EVENT_TASK_READY								0x30
 #define PSF_EVENT_NEW_TIME									0x31
 #define PSF_EVENT_NEW_TIME_SCHEDULER_SUSPENDED				0x32
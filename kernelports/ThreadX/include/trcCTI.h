@@ -1364,6 +1364,11 @@ traceResult xTraceEventCreateData6(uint32_t uiEventCode, TraceUnsignedBaseType_t
 
 traceResult xTraceEventCreateRawBlocking(const void* pxSource, uint32_t ulSize) __attribute__((weak));
 traceResult xTraceEventCreateDataOffline0(uint32_t uiEventCode, const TraceUnsignedBaseType_t* const puxData, TraceUnsignedBaseType_t uxSize) __attribute__((weak));
+traceResult xTraceEventCreateDataV(uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const TraceEventFragment_t* pxFragments, uint32_t uiFragmentCount) __attribute__((weak));
+traceResult xTraceEventBatchEnd(TraceEventBatch_t* pxBatch) __attribute__((weak));
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+traceResult xTraceEventReserve(uint32_t uiEventCode, uint32_t uiDataSize, void** ppvData, TraceEventReservation_t* pxReservation) __attribute__((weak));
+#endif
 
 traceResult xTraceEventCreate0_orig(uint32_t uiEventCode) __attribute__((alias("xTraceEventCreate0")));
 traceResult xTraceEventCreate1_orig(uint32_t uiEventCode, TraceUnsignedBaseType_t uxParam1) __attribute__((alias("xTraceEventCreate1")));
@@ -1383,6 +1388,11 @@ traceResult xTraceEventCreateData6_orig(uint32_t uiEventCode, TraceUnsignedBaseT
 
 traceResult xTraceEventCreateRawBlocking_orig(const void* pxSource, uint32_t ulSize) __attribute__((alias("xTraceEventCreateRawBlocking")));
 traceResult xTraceEventCreateDataOffline0_orig(uint32_t uiEventCode, const TraceUnsignedBaseType_t* const puxData, TraceUnsignedBaseType_t uxSize) __attribute__((alias("xTraceEventCreateDataOffline0")));
+traceResult xTraceEventCreateDataV_orig(uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const TraceEventFragment_t* pxFragments, uint32_t uiFragmentCount) __attribute__((alias("xTraceEventCreateDataV")));
+traceResult xTraceEventBatchEnd_orig(TraceEventBatch_t* pxBatch) __attribute__((alias("xTraceEventBatchEnd")));
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+traceResult xTraceEventReserve_orig(uint32_t uiEventCode, uint32_t uiDataSize, void** ppvData, TraceEventReservation_t* pxReservation) __attribute__((alias("xTraceEventReserve")));
+#endif
 
 #ifdef __IAR_SYSTEMS_ICC__
 
@@ -1434,6 +1444,17 @@ traceResult xTraceEventCreateDataOffline0_orig(uint32_t uiEventCode, const Trace
 #pragma weak xTraceEventCreateDataOffline0
 #pragma weak xTraceEventCreateDataOffline0_orig=xTraceEventCreateDataOffline0
 
+#pragma weak xTraceEventCreateDataV
+#pragma weak xTraceEventCreateDataV_orig=xTraceEventCreateDataV
+
+#pragma weak xTraceEventBatchEnd
+#pragma weak xTraceEventBatchEnd_orig=xTraceEventBatchEnd
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+#pragma weak xTraceEventReserve
+#pragma weak xTraceEventReserve_orig=xTraceEventReserve
+#endif
+
 #endif /* __IAR_SYSTEMS_ICC__ */
 
 #endif /* __inside_trcEvent */
@@ -202,6 +202,8 @@ void vTraceSetMessageBufferName(void* object, const char* name);
 #define PSF_EVENT_TS_CONFIG											2
 #define PSF_EVENT_OBJ_NAME											3
 #define PSF_EVENT_DEFINE_ISR										7
+#define PSF_EVENT_EVENTS_LOST										14
+#define PSF_EVENT_TS_EXTENSION										15
 
 #define PSF_EVENT_STATEMACHINE_STATE_CREATE							0
 #define PSF_EVENT_STATEMACHINE_CREATE								0
@@ -447,6 +449,17 @@ void vTraceSetMessageBufferName(void* object, const char* name);
 #define PSF_EVENT_TASK_CREATE										PSF_EVENT_THREAD_CREATE_SUCCESS
 #define PSF_EVENT_TASK_PRIORITY										PSF_EVENT_THREAD_PRIORITY_CHANGE_SUCCESS
 
+/* Object creates and deletes, which are kept when the current thread is excluded (TRC_CFG_ENABLE_TASK_EXCLUSION) */
+#define TRC_KERNEL_PORT_IS_OBJECT_EVENT(uiEventCode) ( \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_BLOCK_POOL_CREATE_SUCCESS)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_BLOCK_POOL_DELETE_SUCCESS)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_BYTE_POOL_CREATE_SUCCESS)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_BYTE_POOL_DELETE_SUCCESS)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_FLAGS_CREATE_SUCCESS)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_FLAGS_DELETE_SUCCESS)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_MUTEX_CREATE_SUCCESS)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_MUTEX_DELETE_SUCCESS)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_QUEUE_CREATE_SUCCESS)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_QUEUE_DELETE_SUCCESS)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_SEMAPHORE_CREATE_SUCCESS)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_SEMAPHORE_DELETE_SUCCESS)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_THREAD_CREATE_SUCCESS)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_THREAD_DELETE_SUCCESS)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_TIMER_CREATE_SUCCESS)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_TIMER_DELETE_SUCCESS)))
+
 #ifdef __cplusplus
 }
 #endif /* C++ */
@@ -124,6 +124,7 @@ extern traceResult xTraceEventCreateData6_orig(uint32_t uiEventCode, TraceUnsign
 
 extern traceResult xTraceEventCreateRawBlocking_orig(const void* pxSource, uint32_t ulSize);
 extern traceResult xTraceEventCreateDataOffline0_orig(uint32_t uiEventCode, const TraceUnsignedBaseType_t* const puxData, TraceUnsignedBaseType_t uxSize);
+extern traceResult xTraceEventCreateDataV_orig(uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const TraceEventFragment_t* pxFragments, uint32_t uiFragmentCount);
 
 #if !TRC_CFG_SCHEDULING_ONLY
 
@@ -1606,3 +1607,77 @@ traceResult xTraceEventCreateDataOffline0(uint32_t uiEventCode, const TraceUnsig
 
 	return xResult;
 }
+
+traceResult xTraceEventCreateDataV(uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const TraceEventFragment_t* pxFragments, uint32_t uiFragmentCount)
+{
+	traceResult xResult;
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	/* We must use a critical section here or there is a chance that an interrupt
+	 * could fire in the time between checking for a thread switch and the event
+	 * being sent.
+	 */
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	/* Perform a thread switch check before each event to see if ThreadX has switched to a new
+	 * thread without informing us.
+	 */
+	xTraceCheckThreadSwitch();
+
+	xResult = xTraceEventCreateDataV_orig(uiEventCode, puxParams, uiParamCount, pxFragments, uiFragmentCount);
+
+	/* Exit wrapped critical section */
+	TRACE_EXIT_CRITICAL_SECTION();
+
+	return xResult;
+}
+
+traceResult xTraceEventBatchEnd(TraceEventBatch_t* pxBatch)
+{
+	traceResult xResult;
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	/* We must use a critical section here or there is a chance that an interrupt
+	 * could fire in the time between checking for a thread switch and the event
+	 * being sent.
+	 */
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	/* Perform a thread switch check before each event to see if ThreadX has switched to a new
+	 * thread without informing us.
+	 */
+	xTraceCheckThreadSwitch();
+
+	xResult = xTraceEventBatchEnd_orig(pxBatch);
+
+	/* Exit wrapped critical section */
+	TRACE_EXIT_CRITICAL_SECTION();
+
+	return xResult;
+}
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+traceResult xTraceEventReserve(uint32_t uiEventCode, uint32_t uiDataSize, void** ppvData, TraceEventReservation_t* pxReservation)
+{
+	traceResult xResult;
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	/* We must use a critical section here or there is a chance that an interrupt
+	 * could fire in the time between checking for a thread switch and the event
+	 * being reserved. No critical section is held until the reservation is committed.
+	 */
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	/* Perform a thread switch check before each event to see if ThreadX has switched to a new
+	 * thread without informing us.
+	 */
+	xTraceCheckThreadSwitch();
+
+	xResult = xTraceEventReserve_orig(uiEventCode, uiDataSize, ppvData, pxReservation);
+
+	/* Exit wrapped critical section */
+	TRACE_EXIT_CRITICAL_SECTION();
+
+	return xResult;
+}
+#endif
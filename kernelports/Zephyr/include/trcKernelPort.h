@@ -286,6 +286,8 @@ void vTraceSetTimerName(void* object, const char* name);
 #define PSF_EVENT_TASK_PRIO_INHERIT							0x05
 #define PSF_EVENT_TASK_PRIO_DISINHERIT						0x06
 #define PSF_EVENT_DEFINE_ISR								0x07
+#define PSF_EVENT_EVENTS_LOST								0x0E
+#define PSF_EVENT_TS_EXTENSION								0x0F
 
 #define PSF_EVENT_THREAD_SCHED_WAKEUP						0xB6
 #define PSF_EVENT_THREAD_SCHED_ABORT						0x20
@@ -504,6 +506,9 @@ void vTraceSetTimerName(void* object, const char* name);
 #define PSF_EVENT_EVENTGROUP_DELETE							0x25
 #define PSF_EVENT_STREAMBUFFER_DELETE						0x28
 
+/* Object creates and deletes, which are kept when the current task is excluded (TRC_CFG_ENABLE_TASK_EXCLUSION) */
+#define TRC_KERNEL_PORT_IS_OBJECT_EVENT(uiEventCode) ((((uint32_t)(uiEventCode) >= 0x10UL) && ((uint32_t)(uiEventCode) <= 0x2FUL)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_THREAD_ABORT)))
+
 #define PSF_EVENT_NEW_TIME									0x31
 #define PSF_EVENT_NEW_TIME_SCHEDULER_SUSPENDED				0x32
 #define PSF_EVENT_ISR_BEGIN									0x33
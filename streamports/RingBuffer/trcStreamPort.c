@@ -16,6 +16,14 @@
 
 #if (TRC_CFG_RECORDER_MODE == TRC_RECORDER_MODE_STREAMING)
 
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1) && (TRC_CFG_STREAM_PORT_RINGBUFFER_MODE == TRC_STREAM_PORT_RINGBUFFER_MODE_OVERWRITE_WHEN_FULL)
+#error "TRC_CFG_LOCK_FREE_ALLOCATION requires TRC_CFG_STREAM_PORT_RINGBUFFER_MODE to be TRC_STREAM_PORT_RINGBUFFER_MODE_STOP_WHEN_FULL"
+#endif
+
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1) && (TRC_CFG_STREAM_PORT_RINGBUFFER_MODE == TRC_STREAM_PORT_RINGBUFFER_MODE_OVERWRITE_WHEN_FULL)
+#error "TRC_CFG_COMPACT_EVENT_HEADER requires TRC_CFG_STREAM_PORT_RINGBUFFER_MODE to be TRC_STREAM_PORT_RINGBUFFER_MODE_STOP_WHEN_FULL"
+#endif
+
 /* Backwards compatibility with plugins */
 typedef TraceRingBuffer_t RecorderData;
 RecorderData* RecorderDataPtr TRC_CFG_RECORDER_DATA_ATTRIBUTE; /*cstat !MISRAC2004-8.7 !MISRAC2004-8.10 !MISRAC2012-Rule-8.4 !MISRAC2012-Rule-8.7 !MISRAC2012-Rule-8.9_b Suppress global object check*/
@@ -44,6 +52,11 @@ traceResult xTraceStreamPortInitialize(TraceStreamPortBuffer_t* pxBuffer)
 	{
 		return TRC_FAIL;
 	}
+#elif (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+	if (xTraceMultiCoreEventBufferInitialize(&pxStreamPortData->xMultiCoreEventBuffer, TRC_EVENT_BUFFER_OPTION_LOCK_FREE, pxRingBuffer->xEventBuffer.uiBuffer, sizeof(pxRingBuffer->xEventBuffer.uiBuffer)) == TRC_FAIL)
+	{
+		return TRC_FAIL;
+	}
 #else
 	if (xTraceMultiCoreEventBufferInitialize(&pxStreamPortData->xMultiCoreEventBuffer, TRC_EVENT_BUFFER_OPTION_SKIP, pxRingBuffer->xEventBuffer.uiBuffer, sizeof(pxRingBuffer->xEventBuffer.uiBuffer)) == TRC_FAIL)
 	{
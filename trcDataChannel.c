@@ -0,0 +1,55 @@
+/*
+* Trace Recorder for Tracealyzer v4.10.3
+* Copyright 2023 Percepio AB
+* www.percepio.com
+*
+* SPDX-License-Identifier: Apache-2.0
+*
+* The implementation of data channels.
+*/
+
+#include <trcRecorder.h>
+
+#if (TRC_USE_TRACEALYZER_RECORDER == 1) && (TRC_CFG_RECORDER_MODE == TRC_RECORDER_MODE_STREAMING)
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+traceResult xTraceDataChannelCreate(const char* szName, TraceDataChannelHandle_t* pxDataChannelHandle)
+{
+	TraceExtensionHandle_t xExtensionHandle;
+
+	/* This should never fail */
+	TRC_ASSERT(pxDataChannelHandle != (void*)0);
+
+	/* Each channel is an extension with a single event */
+	/* We need to check this */
+	if (xTraceExtensionCreate(szName, 1u, 0u, 0u, 1u, &xExtensionHandle) == TRC_FAIL)
+	{
+		return TRC_FAIL;
+	}
+
+	*pxDataChannelHandle = (TraceDataChannelHandle_t)xExtensionHandle;
+
+	return TRC_SUCCESS;
+}
+
+traceResult xTraceDataChannelWrite(TraceDataChannelHandle_t xDataChannelHandle, const void* pvData, uint32_t uiSize)
+{
+	TraceEventFragment_t xData;
+
+	/* This should never fail */
+	TRC_ASSERT((uiSize == 0u) || (pvData != (void*)0));
+
+	xData.pvData = pvData;
+	xData.uiSize = uiSize;
+
+	return xTraceEventCreateDataV(xTraceExtensionGetEventId((TraceExtensionHandle_t)xDataChannelHandle, 0u), (void*)0, 0u, &xData, 1u);
+}
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+traceResult xTraceDataChannelReserve(TraceDataChannelHandle_t xDataChannelHandle, uint32_t uiSize, void** ppvData, TraceDataChannelReservation_t* pxReservation)
+{
+	return xTraceEventReserve(xTraceExtensionGetEventId((TraceExtensionHandle_t)xDataChannelHandle, 0u), uiSize, ppvData, pxReservation);
+}
+#endif
+
+#endif
@@ -14,22 +14,152 @@
 
 #include <string.h>
 
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+
+#if (TRC_EXTERNAL_BUFFERS == 1)
+#error "TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE can't be used with a stream port where the host reads the entry table from RAM"
+#endif
+
+#if ((TRC_CFG_ENTRY_SYMBOL_MAX_LENGTH) > 255UL)
+#error "Maximum entry symbol length is 255 with TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE!"
+#endif
+
+/* Each symbol in the arena is preceded by a header with the entry index + 1 of its owner, or 0 if free, and the block size */
+#define TRC_ENTRY_SYMBOL_HEADER_SIZE (2UL * sizeof(uint16_t))
+
+/* Header, symbol and null termination, rounded up so the next header is aligned */
+#define TRC_ENTRY_SYMBOL_BLOCK_SIZE(uiLength) TRC_ALIGN_CEIL(TRC_ENTRY_SYMBOL_HEADER_SIZE + (uiLength) + 1UL, sizeof(uint32_t))
+
+#define SYMBOL_ARENA_BYTES ((uint8_t*)pxEntryTable->auiSymbolArena) /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress conversion between pointer types checks*/
+
+/* The header of the block starting at uiBlockOffset */
+#define SYMBOL_BLOCK_HEADER(uiBlockOffset) ((uint16_t*)&SYMBOL_ARENA_BYTES[uiBlockOffset]) /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress conversion between pointer types checks*/
+
+#endif
+
+/* Deleting an entry needs a critical section unless only the lock-free slot has to be given back */
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 0) || (TRC_CFG_ENTRY_HASH_INDEX == 1) || (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+#define TRC_ENTRY_DELETE_LOCKED 1
+#else
+#define TRC_ENTRY_DELETE_LOCKED 0
+#endif
+
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+
+#if (TRC_CFG_RECORDER_BUFFER_ALLOCATION != TRC_RECORDER_BUFFER_ALLOCATION_DYNAMIC)
+#error "TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS requires TRC_CFG_RECORDER_BUFFER_ALLOCATION_DYNAMIC"
+#endif
+
+#if (TRC_EXTERNAL_BUFFERS == 1)
+#error "TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS can't be used with a stream port where the host reads the entry table from RAM"
+#endif
+
+/* The table grows when fewer than half a segment of slots are free */
+#define TRC_ENTRY_TABLE_GROW_LIMIT ((uint32_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS) / 2UL)
+
+/* The entry is in the entry table or in one of the segments */
+#define VALIDATE_ENTRY_HANDLE(xEntryHandle) (prvEntryCalculateIndex((const void*)(xEntryHandle)) < (uint32_t)(TRC_ENTRY_TABLE_SLOTS))
+
+/* The slots that have been allocated so far */
+/*cstat !MISRAC2004-19.4 Suppress macro check*/
+#define GET_ENTRY_SLOT_COUNT() ((uint32_t)(TRC_ENTRY_TABLE_STATIC_SLOTS) + (pxEntryTable->uiSegmentCount * (uint32_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS)))
+
+/* Only for indexes that are allocated */
+#define GET_ENTRY_AT_INDEX(uiIndex) prvEntryGetAtIndex((uint32_t)(uiIndex))
+
+#else
+
 /* (EntryAddress >= FirstEntryAddress) && (EntryAddress < EntryAddressOutsideArray) */
 #define VALIDATE_ENTRY_HANDLE(xEntryHandle) (((void*)(xEntryHandle) >= (void*)&pxEntryTable->axEntries[0]) && ((void*)(xEntryHandle) < (void*)&pxEntryTable->axEntries[TRC_ENTRY_TABLE_SLOTS]))
 
+/*cstat !MISRAC2004-19.4 Suppress macro check*/
+#define GET_ENTRY_SLOT_COUNT() ((uint32_t)(TRC_ENTRY_TABLE_SLOTS))
+
+#define GET_ENTRY_AT_INDEX(uiIndex) (&pxEntryTable->axEntries[uiIndex])
+
+#endif
+
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1)
+
+#ifndef TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32
+#error "TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION requires TRC_CFG_ATOMIC_COMPARE_AND_SWAP_32 to be defined in trcConfig.h"
+#endif
+
+#if ((TRC_ENTRY_TABLE_SLOTS) > 0xFFFF)
+#error "TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION supports at most 65535 entry slots!"
+#endif
+
+/* The free list head holds the index + 1 of the top slot in the lower 16 bits and an ABA tag in the upper 16 bits */
+#define TRC_ENTRY_FREE_LIST_TOP_MASK 0x0000FFFFUL
+#define TRC_ENTRY_FREE_LIST_TAG_ONE 0x00010000UL
+
+/* A new head with the tag incremented, so that a head that was popped and pushed back by someone else is never mistaken for the one we read */
+#define TRC_ENTRY_FREE_LIST_HEAD(uiOldHead, uiTop) ((((uiOldHead) & ~TRC_ENTRY_FREE_LIST_TOP_MASK) + TRC_ENTRY_FREE_LIST_TAG_ONE) | (uiTop))
+
+/*cstat !MISRAC2004-19.4 Suppress macro check*/
+#define GIVE_ENTRY_INDEX(xIndex) prvEntryIndexGive(xIndex)
+
+#else
+
 /*cstat !MISRAC2004-19.4 Suppress macro check*/
 #define GIVE_ENTRY_INDEX(xIndex) pxIndexTable->axFreeIndexes[pxIndexTable->uiFreeIndexCount] = (xIndex); pxIndexTable->uiFreeIndexCount++
 
+#endif
+
 /*cstat !MISRAC2004-19.4 Suppress macro check*/
 #define GET_FREE_INDEX_COUNT() pxIndexTable->uiFreeIndexCount
 
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0)
+/* Marks a slot as created or deleted in the current generation */
+/*cstat !MISRAC2004-19.4 Suppress macro check*/
+#define STAMP_ENTRY_GENERATION(xIndex) pxIndexTable->auiGenerations[xIndex] = (uint16_t)pxIndexTable->uiGeneration
+#else
+#define STAMP_ENTRY_GENERATION(xIndex) 
+#endif
+
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+#define CALCULATE_ENTRY_INDEX(xEntryHandle) (TraceEntryIndex_t)prvEntryCalculateIndex((const void*)(xEntryHandle))
+#else
 /* Index = (EntryAddress - FirstEntryAddress) / EntrySize */
 #define CALCULATE_ENTRY_INDEX(xEntryHandle) (TraceEntryIndex_t)(((TraceUnsignedBaseType_t)(xEntryHandle) - (TraceUnsignedBaseType_t)&pxEntryTable->axEntries[0]) / sizeof(TraceEntry_t))
+#endif
+
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+
+#define TRC_ENTRY_HASH_SLOTS_MASK ((uint32_t)(TRC_ENTRY_HASH_SLOTS) - 1UL)
+
+/* Fibonacci hashing, the top bits of the product are used as the slot */
+#define CALCULATE_ADDRESS_HASH(pvAddress) ((uint32_t)((uint32_t)(TraceUnsignedBaseType_t)(pvAddress) * 2654435769UL) >> (32UL - (uint32_t)(TRC_ENTRY_HASH_SLOTS_SHIFT)))
+
+#endif
 
 /* Private function definitions */
 static traceResult prvEntryIndexInitialize(void);
 static traceResult prvEntryIndexTake(TraceEntryIndex_t *pxIndex);
 
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1)
+static void prvEntryIndexGive(TraceEntryIndex_t xIndex);
+static void prvEntryIndexCountAdd(uint32_t uiValue);
+static void prvEntryIndexSetTaken(TraceEntryIndex_t xIndex);
+static traceResult prvEntryIndexClearTaken(TraceEntryIndex_t xIndex);
+#endif
+
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+static void prvEntryHashInsert(TraceEntryIndex_t xIndex);
+static void prvEntryHashRemove(TraceEntryIndex_t xIndex);
+#endif
+
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+static uint32_t prvEntryCalculateIndex(const void* pvEntry);
+static TraceEntry_t* prvEntryGetAtIndex(uint32_t uiIndex);
+#endif
+
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+static traceResult prvEntrySymbolSet(TraceEntry_t* pxEntry, const char* szSymbol, uint32_t uiLength);
+static void prvEntrySymbolFree(TraceEntry_t* pxEntry);
+static void prvEntrySymbolCompact(void);
+#endif
+
 /* Variables */
 static TraceEntryTable_t *pxEntryTable TRC_CFG_RECORDER_DATA_ATTRIBUTE;
 static TraceEntryIndexTable_t *pxIndexTable TRC_CFG_RECORDER_DATA_ATTRIBUTE;
@@ -60,16 +190,34 @@ traceResult xTraceEntryTableInitialize(TraceEntryTable_t* const pxBuffer)
 	pxEntryTable->uxEntrySymbolLength = (TraceUnsignedBaseType_t)(TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE);
 	pxEntryTable->uxEntryStateCount = (TraceUnsignedBaseType_t)(TRC_ENTRY_TABLE_STATE_COUNT);
 
-	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_SLOTS); i++)
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_STATIC_SLOTS); i++)
 	{
 		pxEntryTable->axEntries[i].pvAddress = 0;
 		for (j = 0u; j < TRC_ENTRY_TABLE_STATE_COUNT; j++)
 		{
 			pxEntryTable->axEntries[i].xStates[j] = (TraceUnsignedBaseType_t)0;
 		}
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+		pxEntryTable->axEntries[i].uiSymbolOffset = 0u;
+		pxEntryTable->axEntries[i].uiSymbolLength = 0u;
+#else
 		pxEntryTable->axEntries[i].szSymbol[0] = (char)0; /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+#endif
 	}
 
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+	pxEntryTable->uiSymbolArenaHead = 0u;
+#endif
+
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+	for (i = 0u; i < (uint32_t)(TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS); i++)
+	{
+		pxEntryTable->apxSegments[i] = (void*)0;
+	}
+
+	pxEntryTable->uiSegmentCount = 0u;
+#endif
+
 	(void)xTraceSetComponentInitialized(TRC_RECORDER_COMPONENT_ENTRY);
 
 	return TRC_SUCCESS;
@@ -81,7 +229,9 @@ traceResult xTraceEntryCreate(TraceEntryHandle_t *pxEntryHandle)
 	TraceEntryIndex_t xIndex;
 	TraceEntry_t *pxEntry;
 
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 0)
 	TRACE_ALLOC_CRITICAL_SECTION();
+#endif
 
 	/* We always check this */
 	if (xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_ENTRY) == 0U)
@@ -92,18 +242,25 @@ traceResult xTraceEntryCreate(TraceEntryHandle_t *pxEntryHandle)
 	/* This should never fail */
 	TRC_ASSERT(pxEntryHandle != (void*)0);
 
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 0)
 	TRACE_ENTER_CRITICAL_SECTION();
+#endif
 
 	if (prvEntryIndexTake(&xIndex) != TRC_SUCCESS)
 	{
 		(void)xTraceDiagnosticsIncrease(TRC_DIAGNOSTICS_ENTRY_SLOTS_NO_ROOM);
 
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 0)
 		TRACE_EXIT_CRITICAL_SECTION();
+#endif
 
 		return TRC_FAIL;
 	}
 
-	pxEntry = &pxEntryTable->axEntries[xIndex];
+	/* The slot is ours alone from here on */
+	STAMP_ENTRY_GENERATION(xIndex);
+
+	pxEntry = GET_ENTRY_AT_INDEX(xIndex);
 	
 	pxEntry->pvAddress = (void*)pxEntry; /* We set a temporary address */
 
@@ -113,11 +270,19 @@ traceResult xTraceEntryCreate(TraceEntryHandle_t *pxEntryHandle)
 	}
 
 	pxEntry->uiOptions = 0u;
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+	/* The symbol of the previous owner was freed when it was deleted */
+	pxEntry->uiSymbolOffset = 0u;
+	pxEntry->uiSymbolLength = 0u;
+#else
 	pxEntry->szSymbol[0] = (char)0; /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+#endif
 
 	*pxEntryHandle = (TraceEntryHandle_t)pxEntry;
 
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 0)
 	TRACE_EXIT_CRITICAL_SECTION();
+#endif
 
 	return TRC_SUCCESS;
 }
@@ -126,7 +291,9 @@ traceResult xTraceEntryDelete(TraceEntryHandle_t xEntryHandle)
 {
 	TraceEntryIndex_t xIndex;
 
+#if (TRC_ENTRY_DELETE_LOCKED == 1)
 	TRACE_ALLOC_CRITICAL_SECTION();
+#endif
 
 	/* This should never fail */
 	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_ENTRY));
@@ -141,24 +308,54 @@ traceResult xTraceEntryDelete(TraceEntryHandle_t xEntryHandle)
 
 	TRC_ASSERT((uint32_t)xIndex < (uint32_t)(TRC_ENTRY_TABLE_SLOTS));
 
+	/* The hash index and symbol arena are still updated in a critical section when slots are lock-free */
+#if (TRC_ENTRY_DELETE_LOCKED == 1)
 	TRACE_ENTER_CRITICAL_SECTION();
+#endif
 
 	if (((TraceEntry_t*)xEntryHandle)->pvAddress == 0)
 	{
 		/* Someone else has deleted this already? */
+#if (TRC_ENTRY_DELETE_LOCKED == 1)
+		TRACE_EXIT_CRITICAL_SECTION();
+#endif
+
+		return TRC_FAIL;
+	}
+
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1)
+	/* Without a critical section several deletes of the same entry can pass the check above, only the one that clears the taken bit gives the slot back */
+	if (prvEntryIndexClearTaken(xIndex) == TRC_FAIL)
+	{
+#if (TRC_ENTRY_DELETE_LOCKED == 1)
 		TRACE_EXIT_CRITICAL_SECTION();
+#endif
 
 		return TRC_FAIL;
 	}
+#endif
+
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+	/* Must be removed while the address is still set */
+	prvEntryHashRemove(xIndex);
+#endif
 
 	/* A valid address, so we assume it is OK. */
 	/* We clear the address field which is used on host to see if entries are active. */
 	((TraceEntry_t*)xEntryHandle)->pvAddress = 0;
 
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+	prvEntrySymbolFree((TraceEntry_t*)xEntryHandle);
+#endif
+
+	STAMP_ENTRY_GENERATION(xIndex);
+
 	/* Give back the index */
 	GIVE_ENTRY_INDEX(xIndex);
 
+#if (TRC_ENTRY_DELETE_LOCKED == 1)
 	TRACE_EXIT_CRITICAL_SECTION();
+#endif
 
 	return TRC_SUCCESS;
 }
@@ -167,6 +364,12 @@ traceResult xTraceEntryFind(const void* const pvAddress, TraceEntryHandle_t* pxE
 {
 	uint32_t i;
 	TraceEntry_t* pxEntry;
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+	uint32_t uiSlot;
+	uint16_t uiValue;
+
+	TRACE_ALLOC_CRITICAL_SECTION();
+#endif
 
 	/* This should never fail */
 	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_ENTRY));
@@ -177,9 +380,38 @@ traceResult xTraceEntryFind(const void* const pvAddress, TraceEntryHandle_t* pxE
 	/* This should never fail */
 	TRC_ASSERT(pvAddress != (void*)0);
 
-	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_SLOTS); i++)
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+	/* Removing an entry moves later entries back into the hole, so a probe without the critical section could miss them */
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	/* Probe until an empty slot is found. The index is never more than half full so this is short. */
+	uiSlot = CALCULATE_ADDRESS_HASH(pvAddress); /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 Suppress conversion from pointer to integer check*/
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_HASH_SLOTS); i++)
+	{
+		uiValue = pxIndexTable->auiAddressHash[uiSlot];
+		if (uiValue == 0u)
+		{
+			break;
+		}
+
+		pxEntry = GET_ENTRY_AT_INDEX(uiValue - 1u);
+		if (pxEntry->pvAddress == pvAddress)
+		{
+			*pxEntryHandle = (TraceEntryHandle_t)pxEntry;
+
+			TRACE_EXIT_CRITICAL_SECTION();
+
+			return TRC_SUCCESS;
+		}
+
+		uiSlot = (uiSlot + 1u) & TRC_ENTRY_HASH_SLOTS_MASK;
+	}
+
+	TRACE_EXIT_CRITICAL_SECTION();
+#else
+	for (i = 0u; i < GET_ENTRY_SLOT_COUNT(); i++)
 	{
-		pxEntry = &pxEntryTable->axEntries[i];
+		pxEntry = GET_ENTRY_AT_INDEX(i);
 		if (pxEntry->pvAddress == pvAddress)
 		{
 			*pxEntryHandle = (TraceEntryHandle_t)pxEntry;
@@ -187,10 +419,43 @@ traceResult xTraceEntryFind(const void* const pvAddress, TraceEntryHandle_t* pxE
 			return TRC_SUCCESS;
 		}
 	}
+#endif
 
 	return TRC_FAIL;
 }
 
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+
+traceResult xTraceEntryCreateWithAddress(void* const pvAddress, TraceEntryHandle_t* pxEntryHandle)
+{
+	TraceEntryIndex_t xIndex;
+
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	/* This should never fail */
+	TRC_ASSERT(pvAddress != (void*)0);
+
+	if (xTraceEntryCreate(pxEntryHandle) == TRC_FAIL)
+	{
+		return TRC_FAIL;
+	}
+
+	xIndex = CALCULATE_ENTRY_INDEX(*pxEntryHandle); /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 Suppress conversion from pointer to integer check*/ /*cstat !MISRAC2004-17.2 !MISRAC2012-Rule-18.2 !MISRAC2012-Rule-18.4 Suppress pointer comparison check*/
+
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	/* The temporary address set by xTraceEntryCreate is never added to the index */
+	((TraceEntry_t*)*pxEntryHandle)->pvAddress = pvAddress;
+
+	prvEntryHashInsert(xIndex);
+
+	TRACE_EXIT_CRITICAL_SECTION();
+
+	return TRC_SUCCESS;
+}
+
+#endif
+
 /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
 traceResult xTraceEntrySetSymbol(const TraceEntryHandle_t xEntryHandle, const char* szSymbol, uint32_t uiLength)
 {
@@ -206,6 +471,18 @@ traceResult xTraceEntrySetSymbol(const TraceEntryHandle_t xEntryHandle, const ch
 	/* Remember the longest symbol name */
 	(void)xTraceDiagnosticsSetIfHigher(TRC_DIAGNOSTICS_ENTRY_SYMBOL_LONGEST_LENGTH, (int32_t)uiLength);
 
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+	if (uiLength > (uint32_t)(TRC_ENTRY_TABLE_SYMBOL_LENGTH))
+	{
+		/* Truncate, the null termination is always added in the arena */
+		uiLength = (uint32_t)(TRC_ENTRY_TABLE_SYMBOL_LENGTH); /*cstat !MISRAC2012-Rule-17.8 Suppress modified function parameter check*/
+	}
+
+	/* This should never fail */
+	TRC_ASSERT(VALIDATE_ENTRY_HANDLE(xEntryHandle)); /*cstat !MISRAC2004-17.3 !MISRAC2012-Rule-18.3 Suppress pointer comparison check*/
+
+	return prvEntrySymbolSet((TraceEntry_t*)xEntryHandle, szSymbol, uiLength);
+#else
 	if (uiLength >= (uint32_t)(TRC_ENTRY_TABLE_SYMBOL_LENGTH))
 	{
 		/* No room for null termination. Set to max. */
@@ -225,8 +502,80 @@ traceResult xTraceEntrySetSymbol(const TraceEntryHandle_t xEntryHandle, const ch
 	memcpy(((TraceEntry_t*)xEntryHandle)->szSymbol, szSymbol, uiLength);
 
 	return TRC_SUCCESS;
+#endif
 }
 
+traceResult xTraceEntryGetRecord(const TraceEntryHandle_t xEntryHandle, TraceEntryRecord_t* pxRecord)
+{
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+	const TraceEntry_t* pxEntry = (const TraceEntry_t*)xEntryHandle;
+	uint32_t i;
+
+	TRACE_ALLOC_CRITICAL_SECTION();
+#endif
+
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_ENTRY));
+
+	/* This should never fail */
+	TRC_ASSERT(pxRecord != (void*)0);
+
+	/* Does not need to be locked. The caller has to lock if the entry may change meanwhile. */
+	/* This should never fail */
+	TRC_ASSERT(VALIDATE_ENTRY_HANDLE(xEntryHandle)); /*cstat !MISRAC2004-17.3 !MISRAC2012-Rule-18.3 Suppress pointer comparison check*/
+
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+	/* The symbol is copied in a critical section since compacting the arena moves it */
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	pxRecord->pvAddress = pxEntry->pvAddress;
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_STATE_COUNT); i++)
+	{
+		pxRecord->xStates[i] = pxEntry->xStates[i];
+	}
+	pxRecord->uiOptions = pxEntry->uiOptions;
+
+	/* The symbol is padded with zeros to the slot size the host expects */
+	memset(pxRecord->szSymbol, 0, sizeof(pxRecord->szSymbol));
+	memcpy(pxRecord->szSymbol, &SYMBOL_ARENA_BYTES[pxEntry->uiSymbolOffset], pxEntry->uiSymbolLength); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the arena*/
+
+	TRACE_EXIT_CRITICAL_SECTION();
+#else
+	memcpy(pxRecord, (void*)xEntryHandle, sizeof(TraceEntryRecord_t));
+#endif
+
+	return TRC_SUCCESS;
+}
+
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+traceResult xTraceEntryGetSymbol(const TraceEntryHandle_t xEntryHandle, const char** pszSymbol)
+{
+	const TraceEntry_t* pxEntry = (const TraceEntry_t*)xEntryHandle;
+
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_ENTRY));
+
+	/* This should never fail */
+	TRC_ASSERT(pszSymbol != (void*)0);
+
+	/* Does not need to be locked. */
+	/* This should never fail */
+	TRC_ASSERT(VALIDATE_ENTRY_HANDLE(xEntryHandle)); /*cstat !MISRAC2004-17.3 !MISRAC2012-Rule-18.3 Suppress pointer comparison check*/
+
+	if (pxEntry->uiSymbolLength == 0u)
+	{
+		*pszSymbol = "";
+	}
+	else
+	{
+		*pszSymbol = (const char*)&SYMBOL_ARENA_BYTES[pxEntry->uiSymbolOffset]; /*cstat !MISRAC2004-17.4_b We need to access a specific part of the arena*/
+	}
+
+	return TRC_SUCCESS;
+}
+#endif
+
 traceResult xTraceEntryGetCount(uint32_t* puiCount)
 {
 	/* This should never fail */
@@ -235,7 +584,7 @@ traceResult xTraceEntryGetCount(uint32_t* puiCount)
 	/* This should never fail */
 	TRC_ASSERT(puiCount != (void*)0);
 
-	*puiCount = (uint32_t)(TRC_ENTRY_TABLE_SLOTS) - GET_FREE_INDEX_COUNT();
+	*puiCount = GET_ENTRY_SLOT_COUNT() - GET_FREE_INDEX_COUNT();
 
 	return TRC_SUCCESS;
 }
@@ -251,13 +600,122 @@ traceResult xTraceEntryGetAtIndex(uint32_t index, TraceEntryHandle_t* pxEntryHan
 	/* This should never fail */
 	TRC_ASSERT(pxEntryHandle != (void*)0);
 
-	*pxEntryHandle = (TraceEntryHandle_t)&pxEntryTable->axEntries[index];
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+	/* We need to check this */
+	if (index >= GET_ENTRY_SLOT_COUNT())
+	{
+		/* The table has not grown this far */
+		return TRC_FAIL;
+	}
+#endif
+
+	*pxEntryHandle = (TraceEntryHandle_t)GET_ENTRY_AT_INDEX(index);
+
+	return TRC_SUCCESS;
+}
+
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+
+traceResult xTraceEntryTableGrow(void)
+{
+	TraceEntry_t* pxSegment;
+	uint32_t i, j;
+	uint32_t uiSegment;
+	uint32_t uiFirstIndex;
+
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_ENTRY));
+
+	/* Only called from one context, so the segment count can't change meanwhile */
+	uiSegment = pxEntryTable->uiSegmentCount;
+
+	if ((GET_FREE_INDEX_COUNT() >= TRC_ENTRY_TABLE_GROW_LIMIT) || (uiSegment >= (uint32_t)(TRC_CFG_ENTRY_TABLE_MAX_SEGMENTS)))
+	{
+		return TRC_SUCCESS;
+	}
+
+	/* Allocated outside of the critical section since the heap may block */
+	pxSegment = (TraceEntry_t*)TRC_KERNEL_PORT_HEAP_MALLOC(sizeof(TraceEntry_t) * (uint32_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS)); /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.5 Suppress conversion from void pointer check*/
+
+	/* We need to check this */
+	if (pxSegment == (void*)0)
+	{
+		return TRC_FAIL;
+	}
+
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS); i++)
+	{
+		pxSegment[i].pvAddress = 0;
+		for (j = 0u; j < TRC_ENTRY_TABLE_STATE_COUNT; j++)
+		{
+			pxSegment[i].xStates[j] = (TraceUnsignedBaseType_t)0;
+		}
+		pxSegment[i].uiOptions = 0u;
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+		pxSegment[i].uiSymbolOffset = 0u;
+		pxSegment[i].uiSymbolLength = 0u;
+#else
+		pxSegment[i].szSymbol[0] = (char)0; /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+#endif
+	}
+
+	pxEntryTable->apxSegments[uiSegment] = pxSegment;
+
+	uiFirstIndex = (uint32_t)(TRC_ENTRY_TABLE_STATIC_SLOTS) + (uiSegment * (uint32_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS));
+
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	/* The segment must be reachable before any of its slots can be taken */
+	pxEntryTable->uiSegmentCount = uiSegment + 1u;
+
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS); i++)
+	{
+		GIVE_ENTRY_INDEX((TraceEntryIndex_t)(uiFirstIndex + i));
+	}
+
+	TRACE_EXIT_CRITICAL_SECTION();
 
 	return TRC_SUCCESS;
 }
 
+#endif
+
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0)
+
+traceResult xTraceEntryGenerationIncrease(void)
+{
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_ENTRY));
+
+	/* Slot generations are 16-bit, so a slot left untouched for exactly a multiple of 65536 generations is seen as changed */
+	pxIndexTable->uiGeneration++;
+
+	return TRC_SUCCESS;
+}
+
+traceResult xTraceEntryIsChangedAtIndex(uint32_t index, uint32_t* puiChanged)
+{
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_ENTRY));
+
+	/* This should never fail */
+	TRC_ASSERT(index < (uint32_t)(TRC_ENTRY_TABLE_SLOTS));
+
+	/* This should never fail */
+	TRC_ASSERT(puiChanged != (void*)0);
+
+	*puiChanged = (pxIndexTable->auiGenerations[index] == (uint16_t)pxIndexTable->uiGeneration) ? 1u : 0u;
+
+	return TRC_SUCCESS;
+}
+
+#endif
+
 #if ((TRC_CFG_USE_TRACE_ASSERT) == 1)
 
+#if (TRC_CFG_ENTRY_HASH_INDEX == 0)
 traceResult xTraceEntryCreateWithAddress(void* const pvAddress, TraceEntryHandle_t* pxEntryHandle)
 {
 	/* This should never fail */
@@ -265,6 +723,7 @@ traceResult xTraceEntryCreateWithAddress(void* const pvAddress, TraceEntryHandle
 
 	return TRC_ENTRY_CREATE_WITH_ADDRESS(pvAddress, pxEntryHandle);
 }
+#endif
 
 traceResult xTraceEntrySetState(const TraceEntryHandle_t xEntryHandle, TraceUnsignedBaseType_t uxStateIndex, TraceUnsignedBaseType_t uxState)
 {
@@ -331,6 +790,7 @@ void* xTraceEntryGetAddressReturn(const TraceEntryHandle_t xEntryHandle)
 	return TRC_ENTRY_GET_ADDRESS_RETURN(xEntryHandle);
 }
 
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE == 0)
 /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
 traceResult xTraceEntryGetSymbol(const TraceEntryHandle_t xEntryHandle, const char** pszSymbol)
 {
@@ -346,6 +806,7 @@ traceResult xTraceEntryGetSymbol(const TraceEntryHandle_t xEntryHandle, const ch
 
 	return TRC_ENTRY_GET_SYMBOL(xEntryHandle, pszSymbol);
 }
+#endif
 
 traceResult xTraceEntryGetState(const TraceEntryHandle_t xEntryHandle, TraceUnsignedBaseType_t uxStateIndex, TraceUnsignedBaseType_t *puxState)
 {
@@ -394,16 +855,139 @@ static traceResult prvEntryIndexInitialize(void)
 {
 	uint32_t i;
 
-	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_SLOTS); i++)
+	/* Slots in segments are given when the entry table grows */
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1)
+	/* Each free slot links to the index + 1 of the next free slot, the last one to 0 */
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_STATIC_SLOTS); i++)
+	{
+		pxIndexTable->axFreeIndexes[i] = (TraceEntryIndex_t)(i + 2u);
+	}
+
+	pxIndexTable->axFreeIndexes[TRC_ENTRY_TABLE_STATIC_SLOTS - 1] = (TraceEntryIndex_t)0;
+
+	/* Slot 0 on top, tag 0 */
+	pxIndexTable->uiFreeListHead = 1u;
+
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TAKEN_WORDS); i++)
+	{
+		pxIndexTable->auiTaken[i] = 0u;
+	}
+#else
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_STATIC_SLOTS); i++)
 	{
 		pxIndexTable->axFreeIndexes[i] = (TraceEntryIndex_t)i;
 	}
+#endif
+
+	pxIndexTable->uiFreeIndexCount = TRC_ENTRY_TABLE_STATIC_SLOTS;
 
-	pxIndexTable->uiFreeIndexCount = TRC_ENTRY_TABLE_SLOTS;
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0)
+	/* Slots are stamped with generation 0 until the first time tracing starts */
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_TABLE_SLOTS); i++)
+	{
+		pxIndexTable->auiGenerations[i] = 0u;
+	}
+
+	pxIndexTable->uiGeneration = 0u;
+#endif
+
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_HASH_SLOTS); i++)
+	{
+		pxIndexTable->auiAddressHash[i] = 0u;
+	}
+#endif
+
+	return TRC_SUCCESS;
+}
+
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1)
+
+static traceResult prvEntryIndexTake(TraceEntryIndex_t *pxIndex)
+{
+	uint32_t uiHead, uiTop, uiNext;
+
+	do
+	{
+		uiHead = pxIndexTable->uiFreeListHead;
+		uiTop = uiHead & TRC_ENTRY_FREE_LIST_TOP_MASK;
+
+		if (uiTop == 0u)
+		{
+			return TRC_FAIL;
+		}
+
+		/* This may be stale if someone else took the slot meanwhile, but then the tag has changed and the swap fails */
+		uiNext = (uint32_t)pxIndexTable->axFreeIndexes[uiTop - 1u];
+	} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxIndexTable->uiFreeListHead, uiHead, TRC_ENTRY_FREE_LIST_HEAD(uiHead, uiNext)) == 0);
+
+	prvEntryIndexCountAdd(UINT32_MAX); /* Wraps to subtract 1 */
+
+	prvEntryIndexSetTaken((TraceEntryIndex_t)(uiTop - 1u));
+
+	*pxIndex = (TraceEntryIndex_t)(uiTop - 1u);
+	return TRC_SUCCESS;
+}
+
+static void prvEntryIndexGive(TraceEntryIndex_t xIndex)
+{
+	uint32_t uiHead;
+
+	do
+	{
+		uiHead = pxIndexTable->uiFreeListHead;
+
+		/* Nobody else can reach this slot's link until the swap has succeeded */
+		pxIndexTable->axFreeIndexes[xIndex] = (TraceEntryIndex_t)(uiHead & TRC_ENTRY_FREE_LIST_TOP_MASK);
+	} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxIndexTable->uiFreeListHead, uiHead, TRC_ENTRY_FREE_LIST_HEAD(uiHead, (uint32_t)xIndex + 1u)) == 0);
+
+	prvEntryIndexCountAdd(1u);
+}
+
+static void prvEntryIndexCountAdd(uint32_t uiValue)
+{
+	uint32_t uiCount;
+
+	/* The count may briefly lag behind the free list, it is only used by xTraceEntryGetCount */
+	do
+	{
+		uiCount = pxIndexTable->uiFreeIndexCount;
+	} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxIndexTable->uiFreeIndexCount, uiCount, uiCount + uiValue) == 0);
+}
+
+static void prvEntryIndexSetTaken(TraceEntryIndex_t xIndex)
+{
+	uint32_t uiWord;
+	uint32_t uiBit = 1UL << ((uint32_t)xIndex & 31UL);
+
+	/* Other bits in the same word may change meanwhile */
+	do
+	{
+		uiWord = pxIndexTable->auiTaken[(uint32_t)xIndex >> 5];
+	} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxIndexTable->auiTaken[(uint32_t)xIndex >> 5], uiWord, uiWord | uiBit) == 0);
+}
+
+static traceResult prvEntryIndexClearTaken(TraceEntryIndex_t xIndex)
+{
+	uint32_t uiWord;
+	uint32_t uiBit = 1UL << ((uint32_t)xIndex & 31UL);
+
+	do
+	{
+		uiWord = pxIndexTable->auiTaken[(uint32_t)xIndex >> 5];
+
+		if ((uiWord & uiBit) == 0u)
+		{
+			/* Someone else is deleting this entry */
+			return TRC_FAIL;
+		}
+	} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxIndexTable->auiTaken[(uint32_t)xIndex >> 5], uiWord, uiWord & ~uiBit) == 0);
 
 	return TRC_SUCCESS;
 }
 
+#else
+
 static traceResult prvEntryIndexTake(TraceEntryIndex_t *pxIndex)
 {
 	/* Critical Section must be active! */
@@ -421,14 +1005,254 @@ static traceResult prvEntryIndexTake(TraceEntryIndex_t *pxIndex)
 	/* Move the last item to the first slot, to avoid holes */
 	pxIndexTable->axFreeIndexes[0] = pxIndexTable->axFreeIndexes[pxIndexTable->uiFreeIndexCount];
 
-#if (TRC_ENTRY_TABLE_SLOTS > 256)
-	pxIndexTable->axFreeIndexes[pxIndexTable->uiFreeIndexCount] = UINT16_MAX;
-#else
-	pxIndexTable->axFreeIndexes[pxIndexTable->uiFreeIndexCount] = UINT8_MAX;
-#endif
+	pxIndexTable->axFreeIndexes[pxIndexTable->uiFreeIndexCount] = (TraceEntryIndex_t)(TRC_ENTRY_INDEX_NONE);
 
 	*pxIndex = xIndex;
 	return TRC_SUCCESS;
 }
 
 #endif
+
+#if (TRC_CFG_ENTRY_HASH_INDEX == 1)
+
+static void prvEntryHashInsert(TraceEntryIndex_t xIndex)
+{
+	/* Critical Section must be active! */
+	uint32_t uiSlot;
+
+	uiSlot = CALCULATE_ADDRESS_HASH(GET_ENTRY_AT_INDEX(xIndex)->pvAddress); /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 Suppress conversion from pointer to integer check*/
+
+	/* There are more hash slots than entries, so an empty slot will always be found */
+	while (pxIndexTable->auiAddressHash[uiSlot] != 0u)
+	{
+		uiSlot = (uiSlot + 1u) & TRC_ENTRY_HASH_SLOTS_MASK;
+	}
+
+	pxIndexTable->auiAddressHash[uiSlot] = (uint16_t)((uint32_t)xIndex + 1u);
+}
+
+static void prvEntryHashRemove(TraceEntryIndex_t xIndex)
+{
+	/* Critical Section must be active! */
+	uint32_t i, uiHole, uiSlot, uiHome;
+	uint16_t uiValue = (uint16_t)((uint32_t)xIndex + 1u);
+
+	/* Find the slot that refers to this entry */
+	uiHole = CALCULATE_ADDRESS_HASH(GET_ENTRY_AT_INDEX(xIndex)->pvAddress); /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 Suppress conversion from pointer to integer check*/
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_HASH_SLOTS); i++)
+	{
+		if (pxIndexTable->auiAddressHash[uiHole] == uiValue)
+		{
+			break;
+		}
+
+		if (pxIndexTable->auiAddressHash[uiHole] == 0u)
+		{
+			/* Not in the index, e.g. an entry that only has its temporary address */
+			return;
+		}
+
+		uiHole = (uiHole + 1u) & TRC_ENTRY_HASH_SLOTS_MASK;
+	}
+
+	/* Shift following slots back into the hole so no probe sequence is broken, which avoids tombstones */
+	uiSlot = uiHole;
+	for (i = 0u; i < (uint32_t)(TRC_ENTRY_HASH_SLOTS); i++)
+	{
+		uiSlot = (uiSlot + 1u) & TRC_ENTRY_HASH_SLOTS_MASK;
+		if (pxIndexTable->auiAddressHash[uiSlot] == 0u)
+		{
+			break;
+		}
+
+		uiHome = CALCULATE_ADDRESS_HASH(GET_ENTRY_AT_INDEX(pxIndexTable->auiAddressHash[uiSlot] - 1u)->pvAddress); /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 Suppress conversion from pointer to integer check*/
+
+		/* Move the value if its home slot is not cyclically within (uiHole, uiSlot] */
+		if (((uiSlot - uiHome) & TRC_ENTRY_HASH_SLOTS_MASK) >= ((uiSlot - uiHole) & TRC_ENTRY_HASH_SLOTS_MASK))
+		{
+			pxIndexTable->auiAddressHash[uiHole] = pxIndexTable->auiAddressHash[uiSlot];
+			uiHole = uiSlot;
+		}
+	}
+
+	pxIndexTable->auiAddressHash[uiHole] = 0u;
+}
+
+#endif
+
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+
+static traceResult prvEntrySymbolSet(TraceEntry_t* pxEntry, const char* szSymbol, uint32_t uiLength)
+{
+	uint32_t uiBlockSize = TRC_ENTRY_SYMBOL_BLOCK_SIZE(uiLength);
+	uint32_t uiBlockOffset;
+	uint16_t* puiHeader;
+
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	/* Empty symbols don't use the arena */
+	if (uiLength == 0u)
+	{
+		prvEntrySymbolFree(pxEntry);
+
+		TRACE_EXIT_CRITICAL_SECTION();
+
+		return TRC_SUCCESS;
+	}
+
+	if ((pxEntry->uiSymbolLength != 0u) && (uiBlockSize <= (uint32_t)SYMBOL_BLOCK_HEADER((uint32_t)pxEntry->uiSymbolOffset - TRC_ENTRY_SYMBOL_HEADER_SIZE)[1]))
+	{
+		/* The new symbol fits in the block of the old one */
+		uiBlockOffset = (uint32_t)pxEntry->uiSymbolOffset - TRC_ENTRY_SYMBOL_HEADER_SIZE;
+	}
+	else
+	{
+		/* The old symbol is kept until the new one has been allocated, so a failed rename doesn't lose it */
+		if ((pxEntryTable->uiSymbolArenaHead + uiBlockSize) > (uint32_t)(TRC_ENTRY_SYMBOL_ARENA_SIZE))
+		{
+			/* Reclaim the space of deleted and renamed entries */
+			prvEntrySymbolCompact();
+
+			if ((pxEntryTable->uiSymbolArenaHead + uiBlockSize) > (uint32_t)(TRC_ENTRY_SYMBOL_ARENA_SIZE))
+			{
+				(void)xTraceDiagnosticsIncrease(TRC_DIAGNOSTICS_ENTRY_SYMBOL_ARENA_NO_ROOM);
+
+				TRACE_EXIT_CRITICAL_SECTION();
+
+				return TRC_FAIL;
+			}
+		}
+
+		uiBlockOffset = pxEntryTable->uiSymbolArenaHead;
+		pxEntryTable->uiSymbolArenaHead += uiBlockSize;
+
+		puiHeader = SYMBOL_BLOCK_HEADER(uiBlockOffset);
+		puiHeader[0] = (uint16_t)(CALCULATE_ENTRY_INDEX(pxEntry) + 1u); /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 Suppress conversion from pointer to integer check*/ /*cstat !MISRAC2004-17.2 !MISRAC2012-Rule-18.2 !MISRAC2012-Rule-18.4 Suppress pointer comparison check*/
+		puiHeader[1] = (uint16_t)uiBlockSize;
+
+		/* The new block is after the old one, so the old one is only marked as free */
+		prvEntrySymbolFree(pxEntry);
+	}
+
+	memcpy(&SYMBOL_ARENA_BYTES[uiBlockOffset + TRC_ENTRY_SYMBOL_HEADER_SIZE], szSymbol, uiLength); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the arena*/
+	SYMBOL_ARENA_BYTES[uiBlockOffset + TRC_ENTRY_SYMBOL_HEADER_SIZE + uiLength] = 0u; /*cstat !MISRAC2004-17.4_b We need to access a specific part of the arena*/
+
+	pxEntry->uiSymbolOffset = (uint16_t)(uiBlockOffset + TRC_ENTRY_SYMBOL_HEADER_SIZE);
+	pxEntry->uiSymbolLength = (uint16_t)uiLength;
+
+	TRACE_EXIT_CRITICAL_SECTION();
+
+	return TRC_SUCCESS;
+}
+
+static void prvEntrySymbolFree(TraceEntry_t* pxEntry)
+{
+	/* Critical Section must be active! */
+	uint32_t uiBlockOffset;
+	uint16_t* puiHeader;
+
+	if (pxEntry->uiSymbolLength == 0u)
+	{
+		return;
+	}
+
+	uiBlockOffset = (uint32_t)pxEntry->uiSymbolOffset - TRC_ENTRY_SYMBOL_HEADER_SIZE;
+	puiHeader = SYMBOL_BLOCK_HEADER(uiBlockOffset);
+
+	if ((uiBlockOffset + (uint32_t)puiHeader[1]) == pxEntryTable->uiSymbolArenaHead)
+	{
+		/* The last block, e.g. when the same entry is renamed again, can be reused right away */
+		pxEntryTable->uiSymbolArenaHead = uiBlockOffset;
+	}
+	else
+	{
+		/* Reclaimed the next time the arena is compacted */
+		puiHeader[0] = 0u;
+	}
+
+	pxEntry->uiSymbolOffset = 0u;
+	pxEntry->uiSymbolLength = 0u;
+}
+
+static void prvEntrySymbolCompact(void)
+{
+	/* Critical Section must be active! */
+	uint32_t uiRead = 0u;
+	uint32_t uiWrite = 0u;
+	uint32_t uiBlockSize;
+	uint32_t uiOwner;
+	uint16_t* puiHeader;
+
+	/* Blocks are moved towards the start of the arena in order, so each block is only moved once */
+	while (uiRead < pxEntryTable->uiSymbolArenaHead)
+	{
+		puiHeader = SYMBOL_BLOCK_HEADER(uiRead);
+		uiOwner = (uint32_t)puiHeader[0];
+		uiBlockSize = (uint32_t)puiHeader[1];
+
+		if (uiOwner != 0u)
+		{
+			if (uiWrite != uiRead)
+			{
+				memmove(&SYMBOL_ARENA_BYTES[uiWrite], &SYMBOL_ARENA_BYTES[uiRead], uiBlockSize); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the arena*/
+			}
+
+			GET_ENTRY_AT_INDEX(uiOwner - 1u)->uiSymbolOffset = (uint16_t)(uiWrite + TRC_ENTRY_SYMBOL_HEADER_SIZE);
+			uiWrite += uiBlockSize;
+		}
+
+		uiRead += uiBlockSize;
+	}
+
+	pxEntryTable->uiSymbolArenaHead = uiWrite;
+}
+
+#endif
+
+#if (TRC_CFG_ENTRY_TABLE_SEGMENT_SLOTS > 0)
+
+static uint32_t prvEntryCalculateIndex(const void* pvEntry)
+{
+	TraceUnsignedBaseType_t uxEntry = (TraceUnsignedBaseType_t)pvEntry; /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 Suppress conversion from pointer to integer check*/
+	TraceUnsignedBaseType_t uxFirst;
+	uint32_t uiSegmentCount = pxEntryTable->uiSegmentCount;
+	uint32_t i;
+
+	/* Index = (EntryAddress - FirstEntryAddress) / EntrySize */
+	uxFirst = (TraceUnsignedBaseType_t)&pxEntryTable->axEntries[0]; /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 Suppress conversion from pointer to integer check*/
+	if ((uxEntry >= uxFirst) && (uxEntry < (uxFirst + (sizeof(TraceEntry_t) * (TraceUnsignedBaseType_t)(TRC_ENTRY_TABLE_STATIC_SLOTS)))))
+	{
+		return (uint32_t)((uxEntry - uxFirst) / sizeof(TraceEntry_t));
+	}
+
+	/* Segment indexes continue after the entry table */
+	for (i = 0u; i < uiSegmentCount; i++)
+	{
+		uxFirst = (TraceUnsignedBaseType_t)pxEntryTable->apxSegments[i]; /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 Suppress conversion from pointer to integer check*/
+		if ((uxEntry >= uxFirst) && (uxEntry < (uxFirst + (sizeof(TraceEntry_t) * (TraceUnsignedBaseType_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS)))))
+		{
+			return (uint32_t)(TRC_ENTRY_TABLE_STATIC_SLOTS) + (i * (uint32_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS)) + (uint32_t)((uxEntry - uxFirst) / sizeof(TraceEntry_t));
+		}
+	}
+
+	/* Not an entry */
+	return (uint32_t)(TRC_ENTRY_TABLE_SLOTS);
+}
+
+static TraceEntry_t* prvEntryGetAtIndex(uint32_t uiIndex)
+{
+	if (uiIndex < (uint32_t)(TRC_ENTRY_TABLE_STATIC_SLOTS))
+	{
+		return &pxEntryTable->axEntries[uiIndex];
+	}
+
+	uiIndex -= (uint32_t)(TRC_ENTRY_TABLE_STATIC_SLOTS); /*cstat !MISRAC2012-Rule-17.8 Suppress modified function parameter check*/
+
+	return &pxEntryTable->apxSegments[uiIndex / (uint32_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS)][uiIndex % (uint32_t)(TRC_ENTRY_TABLE_SEGMENT_SLOTS)];
+}
+
+#endif
+
+#endif
@@ -24,7 +24,14 @@
  */
 #define TRC_EVENT_GET_PARAM_COUNT(id) (((id) >> 12u) & 0xFU)
 
-#if (TRC_CFG_CORE_COUNT > 1)
+#if (TRC_CFG_EXTENDED_EVENT_HEADER == 0) && (TRC_CFG_CORE_COUNT > 16)
+#error "TRC_CFG_CORE_COUNT above 16 requires TRC_CFG_EXTENDED_EVENT_HEADER"
+#endif
+
+#if (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+/* The core ID has a field of its own */
+#define TRC_EVENT_SET_EVENT_COUNT(c) ((uint32_t)(c))
+#elif (TRC_CFG_CORE_COUNT > 1)
 #define TRC_EVENT_SET_EVENT_COUNT(c)  ((uint16_t)(((TRC_CFG_GET_CURRENT_CORE() & 0xF) << 12) | ((uint16_t)(c) & 0xFFF)))
 #else
 #define TRC_EVENT_SET_EVENT_COUNT(c) ((uint16_t)(c))
@@ -35,15 +42,90 @@
  */
 #define TRC_EVENT_GET_SIZE(pvAddress, puiSize) (*(uint32_t*)(puiSize) = sizeof(TraceEvent0_t) + (TRC_EVENT_GET_PARAM_COUNT(((TraceEvent0_t*)(pvAddress))->EventID)) * sizeof(TraceBaseType_t), TRC_SUCCESS)
 
+#if (TRC_CFG_EXTENDED_EVENT_HEADER == 1) && (TRC_BASE_TYPE_SIZE == 8)
+/* The extended header is padded to 16 bytes so 64-bit parameters stay aligned */
+#define TRC_EVENT_CLEAR_PADDING(pxEvent) ((pxEvent)->Padding = 0u)
+#else
+#define TRC_EVENT_CLEAR_PADDING(pxEvent) ((void)0)
+#endif
+
 /**
  * @internal Macro helper for setting base event data.
  */
+#if (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
 #define SET_BASE_EVENT_DATA(pxEvent, eventId, paramCount, eventCount) \
 	( \
 		(pxEvent)->EventID = TRC_EVENT_SET_PARAM_COUNT(eventId, paramCount), \
+		(pxEvent)->CoreID = (uint16_t)TRC_CFG_GET_CURRENT_CORE(), \
 		(pxEvent)->EventCount = TRC_EVENT_SET_EVENT_COUNT(eventCount), \
+		TRC_EVENT_CLEAR_PADDING(pxEvent), \
 		(void)xTraceTimestampGet(&(pxEvent)->TS) \
 	)
+#elif (TRC_CFG_COMPACT_EVENT_HEADER == 0)
+#define SET_BASE_EVENT_DATA(pxEvent, eventId, paramCount, eventCount) \
+	( \
+		(pxEvent)->EventID = TRC_EVENT_SET_PARAM_COUNT(eventId, paramCount), \
+		(pxEvent)->EventCount = TRC_EVENT_SET_EVENT_COUNT(eventCount), \
+		(void)xTraceTimestampGet(&(pxEvent)->TS) \
+	)
+#endif
+
+#if (TRC_CFG_EXTENDED_EVENT_HEADER == 1) && (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+#error "TRC_CFG_EXTENDED_EVENT_HEADER can't be used together with TRC_CFG_COMPACT_EVENT_HEADER"
+#endif
+
+#if (TRC_CFG_EXTENDED_EVENT_HEADER == 1) || (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+/* Fails to compile if TRC_BASE_TYPE_SIZE doesn't match TRC_UNSIGNED_BASE_TYPE */
+typedef uint8_t TraceEventBaseTypeSizeCheck_t[(sizeof(TraceUnsignedBaseType_t) == (TRC_BASE_TYPE_SIZE)) ? 1 : -1];
+#endif
+
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+
+#if (TRC_CFG_CORE_COUNT > 1)
+#error "TRC_CFG_COMPACT_EVENT_HEADER requires TRC_CFG_CORE_COUNT to be 1"
+#endif
+
+/* The compact header is only followed by parameters without padding if they are 32-bit */
+#if (TRC_BASE_TYPE_SIZE != 4)
+#error "TRC_CFG_COMPACT_EVENT_HEADER requires a 32-bit TRC_UNSIGNED_BASE_TYPE"
+#endif
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+#error "TRC_CFG_COMPACT_EVENT_HEADER can't be used together with TRC_CFG_LOCK_FREE_ALLOCATION"
+#endif
+
+#define TRACE_EVENT_ALLOC_CRITICAL_SECTION() TRACE_ALLOC_CRITICAL_SECTION()
+
+/* The event counter and timestamp are set by prvTraceEventAllocateCompact */
+#define TRACE_EVENT_BEGIN_OFFLINE(size) 														\
+	TRACE_ENTER_CRITICAL_SECTION();              										\
+	if (prvTraceEventAllocateCompact((uint32_t)(size), (void**)&pxEventData) == TRC_FAIL) /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/ \
+	{                                            										\
+		TRACE_EXIT_CRITICAL_SECTION();              									\
+		return TRC_FAIL; 																\
+	} 																					\
+	pxEventData->EventID = TRC_EVENT_SET_PARAM_COUNT(uiEventCode, ((size) - sizeof(TraceEvent0_t)) / sizeof(TraceUnsignedBaseType_t));
+
+#elif (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+
+#if (TRC_USE_INTERNAL_BUFFER == 0) && (TRC_EXTERNAL_BUFFERS == 0)
+#error "TRC_CFG_LOCK_FREE_ALLOCATION requires a stream port that allocates directly from an event buffer"
+#endif
+
+/* Events are allocated without a critical section, so there is no status to store */
+#define TRACE_EVENT_ALLOC_CRITICAL_SECTION()
+
+#define TRACE_EVENT_BEGIN_OFFLINE(size) 														\
+	if (xTraceStreamPortAllocate((uint32_t)(size), (void**)&pxEventData) == TRC_FAIL) /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/ \
+	{                                            										\
+		(void)prvTraceEventCounterIncrement();											\
+		return TRC_FAIL; 																\
+	} 																					\
+	SET_BASE_EVENT_DATA(pxEventData, uiEventCode, ((size) - sizeof(TraceEvent0_t)) / sizeof(TraceUnsignedBaseType_t), prvTraceEventCounterIncrement()); /*cstat !MISRAC2012-Rule-11.5 Suppress pointer checks*/
+
+#else
+
+#define TRACE_EVENT_ALLOC_CRITICAL_SECTION() TRACE_ALLOC_CRITICAL_SECTION()
 
 #define TRACE_EVENT_BEGIN_OFFLINE(size) 														\
 	TRACE_ENTER_CRITICAL_SECTION();              										\
@@ -55,21 +137,95 @@
 	} 																					\
 	SET_BASE_EVENT_DATA(pxEventData, uiEventCode, ((size) - sizeof(TraceEvent0_t)) / sizeof(TraceUnsignedBaseType_t), pxTraceEventDataTable->coreEventData[TRC_CFG_GET_CURRENT_CORE()].eventCounter); /*cstat !MISRAC2012-Rule-11.5 Suppress pointer checks*/
 
+#endif
+
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+/**
+ * @internal Macro helper for checking if an event code is excluded by the event filter.
+ */
+#define TRC_EVENT_IS_EXCLUDED(uiEventCode) ((pxTraceEventDataTable->auiExcludedEvents[((uint32_t)(uiEventCode) & 0xFFFUL) >> 5] & (1UL << ((uint32_t)(uiEventCode) & 0x1FUL))) != 0UL)
+
+/* Excluded events are dropped before the critical section is entered */
+#define TRACE_EVENT_FILTER() 															\
+	if (TRC_EVENT_IS_EXCLUDED(uiEventCode))     										\
+	{ 																					\
+		return TRC_SUCCESS;                         									\
+	}
+#else
+#define TRACE_EVENT_FILTER()
+#endif
+
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+
+#ifndef TRC_KERNEL_PORT_IS_OBJECT_EVENT
+#define TRC_KERNEL_PORT_IS_OBJECT_EVENT(uiEventCode) (((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_TASK_CREATE)) || ((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_TASK_DELETE)))
+#endif
+
+/*
+ * Events from an excluded task are dropped, except for:
+ * - event codes below 0x10, e.g. object names (PSF_EVENT_OBJ_NAME) and ISR definitions,
+ * - task switches to it (PSF_EVENT_TASK_ACTIVATE),
+ * - kernel object creates and deletes (TRC_KERNEL_PORT_IS_OBJECT_EVENT),
+ * - state machine, interval, counter, heap and extension creates.
+ * Objects created by an excluded task are then still known by name. Events from ISRs that interrupt it are kept.
+ */
+#define TRC_EVENT_IS_KEPT_FOR_EXCLUDED_TASK(uiEventCode) ( \
+	((uint32_t)(uiEventCode) < 0x10UL) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_TASK_ACTIVATE)) || \
+	TRC_KERNEL_PORT_IS_OBJECT_EVENT(uiEventCode) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_STATEMACHINE_CREATE)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_STATEMACHINE_STATE_CREATE)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_INTERVAL_CHANNEL_CREATE)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_INTERVAL_CHANNEL_SET_CREATE)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_COUNTER_CREATE)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_HEAP_CREATE)) || \
+	((uint32_t)(uiEventCode) == (uint32_t)(PSF_EVENT_EXTENSION_CREATE)))
+
+#define TRC_EVENT_IS_TASK_EXCLUDED(uiEventCode) ((xTraceTaskIsCurrentExcluded() != 0u) && (xTraceISRGetCurrentNestingReturned() < 0) && !TRC_EVENT_IS_KEPT_FOR_EXCLUDED_TASK(uiEventCode))
+
+#define TRACE_EVENT_TASK_EXCLUSION() 													\
+	if (TRC_EVENT_IS_TASK_EXCLUDED(uiEventCode)) 										\
+	{ 																					\
+		return TRC_SUCCESS;                         									\
+	}
+#else
+#define TRACE_EVENT_TASK_EXCLUSION()
+#endif
+
 #define TRACE_EVENT_BEGIN(size) 														\
 	/* We need to check this */                  										\
 	if (!xTraceIsRecorderEnabled())              										\
 	{ 																					\
 		return TRC_FAIL;                            									\
 	} 																					\
+	TRACE_EVENT_FILTER() 																\
+	TRACE_EVENT_TASK_EXCLUSION() 														\
 	TRACE_EVENT_BEGIN_OFFLINE(size)
 
 
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+#define TRACE_EVENT_END(size) 															\
+	(void)xTraceStreamPortCommit(pxEventData, (uint32_t)(size), &iBytesCommitted); 		\
+	/* We need to use iBytesCommitted for the above call but do not use the value */	\
+	/* Remove potential warnings */ 													\
+	(void)iBytesCommitted;
+#elif (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+/* If the event was dropped when committed, the next event must store a timestamp extension */
+#define TRACE_EVENT_END(size) 															\
+	(void)xTraceStreamPortCommit(pxEventData, (uint32_t)(size), &iBytesCommitted); 		\
+	if (iBytesCommitted == 0) 															\
+	{ 																					\
+		pxTraceEventDataTable->coreEventData[TRC_CFG_GET_CURRENT_CORE()].uiLastEventCounter--; \
+	} 																					\
+	TRACE_EXIT_CRITICAL_SECTION();
+#else
 #define TRACE_EVENT_END(size) 															\
 	(void)xTraceStreamPortCommit(pxEventData, (uint32_t)(size), &iBytesCommitted); 		\
 	TRACE_EXIT_CRITICAL_SECTION(); 														\
 	/* We need to use iBytesCommitted for the above call but do not use the value */	\
 	/* Remove potential warnings */ 													\
 	(void)iBytesCommitted;
+#endif
 
 #define TRACE_EVENT_ADD_1(__p1)									\
 	pxEventData->uxParams[0] = __p1;
@@ -123,6 +279,93 @@
 
 TraceEventDataTable_t *pxTraceEventDataTable TRC_CFG_RECORDER_DATA_ATTRIBUTE;
 
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+/**
+ * @internal Increments the event counter of the current core without a critical section.
+ *
+ * @returns The new event counter value.
+ */
+static uint32_t prvTraceEventCounterIncrement(void)
+{
+	uint32_t* puiEventCounter = &pxTraceEventDataTable->coreEventData[TRC_CFG_GET_CURRENT_CORE()].eventCounter;
+	uint32_t uiEventCounter;
+
+	do
+	{
+		uiEventCounter = *puiEventCounter;
+	} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(puiEventCounter, uiEventCounter, uiEventCounter + 1u) == 0);
+
+	return uiEventCounter + 1u;
+}
+#endif
+
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+/**
+ * @internal Allocates an event with a compact header and sets its timestamp delta.
+ *
+ * A timestamp extension event is stored first if the delta does not fit in
+ * the header, or if events were lost since the last stored event.
+ * Critical section must be active!
+ *
+ * @param[in] uiSize Event size.
+ * @param[out] ppvData Pointer to allocated event.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+static traceResult prvTraceEventAllocateCompact(uint32_t uiSize, void** ppvData)
+{
+	TraceCoreEventData_t* pxCoreEventData = &pxTraceEventDataTable->coreEventData[TRC_CFG_GET_CURRENT_CORE()];
+	TraceEvent2_t* pxExtensionData = (void*)0;
+	int32_t iBytesCommitted = 0;
+	uint32_t uiTimestamp = 0u;
+	uint32_t uiDelta;
+
+	pxCoreEventData->eventCounter++;
+
+	(void)xTraceTimestampGet(&uiTimestamp);
+	uiDelta = uiTimestamp - pxCoreEventData->uiLastTimestamp;
+
+	/* Events that failed to be allocated, or raw data, have increased the counter without being stored */
+	if ((pxCoreEventData->eventCounter != (pxCoreEventData->uiLastEventCounter + 1u)) || (uiDelta > 0xFFFFUL))
+	{
+		if (xTraceStreamPortAllocate(sizeof(TraceEvent2_t), (void**)&pxExtensionData) == TRC_FAIL) /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/
+		{
+			return TRC_FAIL;
+		}
+
+		/* The extension holds the full timestamp and event count of the event that follows it */
+		pxExtensionData->EventID = TRC_EVENT_SET_PARAM_COUNT(PSF_EVENT_TS_EXTENSION, 2u);
+		pxExtensionData->DTS = 0u;
+		pxExtensionData->uxParams[0] = (TraceUnsignedBaseType_t)uiTimestamp;
+		pxExtensionData->uxParams[1] = (TraceUnsignedBaseType_t)pxCoreEventData->eventCounter;
+
+		(void)xTraceStreamPortCommit(pxExtensionData, sizeof(TraceEvent2_t), &iBytesCommitted);
+
+		/* The event can't be stored without its extension */
+		if (iBytesCommitted == 0)
+		{
+			return TRC_FAIL;
+		}
+
+		uiDelta = 0u;
+	}
+
+	if (xTraceStreamPortAllocate(uiSize, ppvData) == TRC_FAIL)
+	{
+		/* The counter gap makes the next event store an extension */
+		return TRC_FAIL;
+	}
+
+	((TraceEvent0_t*)*ppvData)->DTS = (uint16_t)uiDelta; /*cstat !MISRAC2012-Rule-11.5 Suppress pointer checks*/
+
+	pxCoreEventData->uiLastTimestamp = uiTimestamp;
+	pxCoreEventData->uiLastEventCounter = pxCoreEventData->eventCounter;
+
+	return TRC_SUCCESS;
+}
+#endif
+
 traceResult xTraceEventInitialize(TraceEventDataTable_t* pxBuffer)
 {
 	uint32_t i;
@@ -132,11 +375,27 @@ traceResult xTraceEventInitialize(TraceEventDataTable_t* pxBuffer)
 
 	pxTraceEventDataTable = pxBuffer;
 
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+	for (i = 0u; i < (uint32_t)(TRC_EVENT_FILTER_WORD_COUNT); i++)
+	{
+		pxTraceEventDataTable->auiExcludedEvents[i] = 0u;
+	}
+#endif
+
 	for (i = 0u; i < (uint32_t)(TRC_CFG_CORE_COUNT); i++)
 	{
 		pxTraceEventDataTable->coreEventData[i].eventCounter = 0u;
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+		pxTraceEventDataTable->coreEventData[i].uiLastTimestamp = 0u;
+		/* Makes the first event store a timestamp extension */
+		pxTraceEventDataTable->coreEventData[i].uiLastEventCounter = 0xFFFFFFFFUL;
+#endif
 	}
 
+#if (TRC_CFG_ENABLE_FRAGMENTED_EVENTS == 1)
+	pxTraceEventDataTable->uiFragmentSequence = 0u;
+#endif
+
 	(void)xTraceSetComponentInitialized(TRC_RECORDER_COMPONENT_EVENT);
 
 	return TRC_SUCCESS;
@@ -147,7 +406,7 @@ traceResult xTraceEventCreate0(uint32_t uiEventCode)
 	TraceEvent0_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	TRACE_EVENT_BEGIN(sizeof(TraceEvent0_t));
 	TRACE_EVENT_END(sizeof(TraceEvent0_t));
@@ -160,7 +419,7 @@ traceResult xTraceEventCreate1(uint32_t uiEventCode, TraceUnsignedBaseType_t uxP
 	TraceEvent1_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	TRACE_EVENT_BEGIN(sizeof(TraceEvent1_t));
 
@@ -176,7 +435,7 @@ traceResult xTraceEventCreate2(uint32_t uiEventCode, TraceUnsignedBaseType_t uxP
 	TraceEvent2_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	TRACE_EVENT_BEGIN(sizeof(TraceEvent2_t));
 
@@ -192,7 +451,7 @@ traceResult xTraceEventCreate3(uint32_t uiEventCode, TraceUnsignedBaseType_t uxP
 	TraceEvent3_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	TRACE_EVENT_BEGIN(sizeof(TraceEvent3_t));
 
@@ -208,7 +467,7 @@ traceResult xTraceEventCreate4(uint32_t uiEventCode, TraceUnsignedBaseType_t uxP
 	TraceEvent4_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	TRACE_EVENT_BEGIN(sizeof(TraceEvent4_t));
 
@@ -224,7 +483,7 @@ traceResult xTraceEventCreate5(uint32_t uiEventCode, TraceUnsignedBaseType_t uxP
 	TraceEvent5_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	TRACE_EVENT_BEGIN(sizeof(TraceEvent5_t));
 
@@ -240,7 +499,7 @@ traceResult xTraceEventCreate6(uint32_t uiEventCode, TraceUnsignedBaseType_t uxP
 	TraceEvent6_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	TRACE_EVENT_BEGIN(sizeof(TraceEvent6_t));
 
@@ -262,7 +521,11 @@ traceResult xTraceEventCreateRawBlocking(const void* pxSource, uint32_t ulSize)
 
 	TRACE_ENTER_CRITICAL_SECTION();
 
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+	(void)prvTraceEventCounterIncrement();
+#else
 	pxTraceEventDataTable->coreEventData[TRC_CFG_GET_CURRENT_CORE()].eventCounter++;
+#endif
 	while (xTraceStreamPortAllocate(ulSize, (void**)&pxBuffer) == TRC_FAIL) {}
 
 	memcpy(pxBuffer, pxSource, ulSize);
@@ -279,7 +542,7 @@ traceResult xTraceEventCreateDataOffline0(uint32_t uiEventCode, const TraceUnsig
 	TraceEvent0_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	/* Align payload size and truncate in case it is too big */
 	uxSize = TRC_ALIGN_CEIL(uxSize, sizeof(TraceUnsignedBaseType_t));
@@ -302,7 +565,7 @@ traceResult xTraceEventCreateData0(uint32_t uiEventCode, const TraceUnsignedBase
 	TraceEvent0_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	/* Align payload size and truncate in case it is too big */
 	uxSize = TRC_ALIGN_CEIL(uxSize, sizeof(TraceUnsignedBaseType_t));
@@ -330,7 +593,7 @@ traceResult xTraceEventCreateData1(
 	TraceEvent1_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	/* Align payload size and truncate in case it is too big */
 	uxSize = TRC_ALIGN_CEIL(uxSize, sizeof(TraceUnsignedBaseType_t));
@@ -359,7 +622,7 @@ traceResult xTraceEventCreateData2(
 	TraceEvent2_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	/* Align payload size and truncate in case it is too big */
 	uxSize = TRC_ALIGN_CEIL(uxSize, sizeof(TraceUnsignedBaseType_t));
@@ -389,7 +652,7 @@ traceResult xTraceEventCreateData3(
 	TraceEvent3_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	/* Align payload size and truncate in case it is too big */
 	uxSize = TRC_ALIGN_CEIL(uxSize, sizeof(TraceUnsignedBaseType_t));
@@ -420,7 +683,7 @@ traceResult xTraceEventCreateData4(
 	TraceEvent4_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	/* Align payload size and truncate in case it is too big */
 	uxSize = TRC_ALIGN_CEIL(uxSize, sizeof(TraceUnsignedBaseType_t));
@@ -452,7 +715,7 @@ traceResult xTraceEventCreateData5(
 	TraceEvent5_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	/* Align payload size and truncate in case it is too big */
 	uxSize = TRC_ALIGN_CEIL(uxSize, sizeof(TraceUnsignedBaseType_t));
@@ -485,7 +748,7 @@ traceResult xTraceEventCreateData6(
 	TraceEvent6_t* pxEventData = (void*)0;
 	int32_t iBytesCommitted = 0;
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
 
 	/* Align payload size and truncate in case it is too big */
 	uxSize = TRC_ALIGN_CEIL(uxSize, sizeof(TraceUnsignedBaseType_t));
@@ -503,6 +766,497 @@ traceResult xTraceEventCreateData6(
 	return TRC_SUCCESS;
 }
 
+traceResult xTraceEventCreateDataV(uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const TraceEventFragment_t* pxFragments, uint32_t uiFragmentCount)
+{
+	TraceEvent0_t* pxEventData = (void*)0;
+	int32_t iBytesCommitted = 0;
+	uint32_t uiParamSize;
+	uint32_t uiDataSize = 0u;
+	uint32_t uiOffset;
+	uint32_t uiCopySize;
+	uint32_t i;
+
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
+
+	/* This should never fail */
+	TRC_ASSERT((uiParamCount == 0u) || (puxParams != (void*)0));
+
+	/* This should never fail */
+	TRC_ASSERT((uiFragmentCount == 0u) || (pxFragments != (void*)0));
+
+	uiParamSize = uiParamCount * sizeof(TraceUnsignedBaseType_t);
+
+	/* This should never fail */
+	TRC_ASSERT((sizeof(TraceEvent0_t) + uiParamSize) <= (uint32_t)(TRC_MAX_BLOB_SIZE));
+
+	for (i = 0u; i < uiFragmentCount; i++)
+	{
+		uiDataSize += pxFragments[i].uiSize;
+	}
+
+	/* Align payload size and truncate in case it is too big */
+	uiDataSize = TRC_ALIGN_CEIL(uiDataSize, sizeof(TraceUnsignedBaseType_t));
+	if (sizeof(TraceEvent0_t) + uiParamSize + uiDataSize > TRC_MAX_BLOB_SIZE)
+	{
+		uiDataSize = TRC_MAX_BLOB_SIZE - sizeof(TraceEvent0_t) - uiParamSize;
+	}
+
+	TRACE_EVENT_BEGIN(sizeof(TraceEvent0_t) + uiParamSize + uiDataSize);
+
+	if (uiParamSize != 0u)
+	{
+		memcpy(&((uint8_t*)pxEventData)[sizeof(TraceEvent0_t)], puxParams, uiParamSize);
+	}
+
+	/* Copy the fragments straight into the event and zero the padding */
+	uiOffset = 0u;
+	for (i = 0u; (i < uiFragmentCount) && (uiOffset < uiDataSize); i++)
+	{
+		uiCopySize = pxFragments[i].uiSize;
+		if (uiCopySize > (uiDataSize - uiOffset))
+		{
+			uiCopySize = uiDataSize - uiOffset;
+		}
+
+		memcpy(&((uint8_t*)pxEventData)[sizeof(TraceEvent0_t) + uiParamSize + uiOffset], pxFragments[i].pvData, uiCopySize);
+		uiOffset += uiCopySize;
+	}
+
+	if (uiOffset < uiDataSize)
+	{
+		(void)memset(&((uint8_t*)pxEventData)[sizeof(TraceEvent0_t) + uiParamSize + uiOffset], 0, uiDataSize - uiOffset);
+	}
+
+	TRACE_EVENT_END(sizeof(TraceEvent0_t) + uiParamSize + uiDataSize);
+
+	return TRC_SUCCESS;
+}
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+traceResult xTraceEventReserve(uint32_t uiEventCode, uint32_t uiDataSize, void** ppvData, TraceEventReservation_t* pxReservation)
+{
+	TraceEvent0_t* pxEventData = (void*)0;
+	uint32_t uiSize;
+
+	/* This should never fail */
+	TRC_ASSERT(ppvData != (void*)0);
+
+	/* This should never fail */
+	TRC_ASSERT(pxReservation != (void*)0);
+
+	uiSize = sizeof(TraceEvent0_t) + TRC_ALIGN_CEIL(uiDataSize, sizeof(TraceUnsignedBaseType_t));
+
+	/* The caller writes the whole payload, so it can't be truncated */
+	/* We need to check this */
+	if (uiSize > (uint32_t)(TRC_MAX_BLOB_SIZE))
+	{
+		return TRC_FAIL;
+	}
+
+	/* We need to check this */
+	if (!xTraceIsRecorderEnabled())
+	{
+		return TRC_FAIL;
+	}
+
+	/* Excluded events fail so that the caller does not write anything */
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+	if (TRC_EVENT_IS_EXCLUDED(uiEventCode))
+	{
+		return TRC_FAIL;
+	}
+#endif
+
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+	if (TRC_EVENT_IS_TASK_EXCLUDED(uiEventCode))
+	{
+		return TRC_FAIL;
+	}
+#endif
+
+	TRACE_EVENT_BEGIN_OFFLINE(uiSize);
+
+	/* Only uiDataSize bytes are written by the caller, so the padding is cleared here */
+	if (uiSize > sizeof(TraceEvent0_t))
+	{
+		((TraceUnsignedBaseType_t*)&((uint8_t*)pxEventData)[sizeof(TraceEvent0_t)])[((uiSize - sizeof(TraceEvent0_t)) / sizeof(TraceUnsignedBaseType_t)) - 1u] = 0u; /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/
+	}
+
+	pxReservation->pvEvent = (void*)pxEventData;
+	pxReservation->uiSize = uiSize;
+
+	*ppvData = (void*)&((uint8_t*)pxEventData)[sizeof(TraceEvent0_t)];
+
+	return TRC_SUCCESS;
+}
+
+traceResult xTraceEventCommitReservation(TraceEventReservation_t* pxReservation)
+{
+	TraceEvent0_t* pxEventData;
+	int32_t iBytesCommitted = 0;
+
+	/* This should never fail */
+	TRC_ASSERT(pxReservation != (void*)0);
+
+	/* This should never fail */
+	TRC_ASSERT(pxReservation->pvEvent != (void*)0);
+
+	pxEventData = (TraceEvent0_t*)pxReservation->pvEvent; /*cstat !MISRAC2012-Rule-11.5 Suppress pointer checks*/
+
+	TRACE_EVENT_END(pxReservation->uiSize);
+
+	pxReservation->pvEvent = (void*)0;
+
+	return TRC_SUCCESS;
+}
+#endif
+
+#if (TRC_CFG_ENABLE_FRAGMENTED_EVENTS == 1)
+/**
+ * @internal Gets a new sequence ID for a payload stored in fragments.
+ *
+ * @returns The sequence ID.
+ */
+static uint32_t prvTraceEventNextFragmentSequence(void)
+{
+	uint32_t* puiSequence = &pxTraceEventDataTable->uiFragmentSequence;
+	uint32_t uiSequence;
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+
+	do
+	{
+		uiSequence = *puiSequence;
+	} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(puiSequence, uiSequence, uiSequence + 1u) == 0);
+#else
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	TRACE_ENTER_CRITICAL_SECTION();
+	uiSequence = *puiSequence;
+	*puiSequence = uiSequence + 1u;
+	TRACE_EXIT_CRITICAL_SECTION();
+#endif
+
+	return (uiSequence + 1u) & 0xFFFFUL;
+}
+
+traceResult xTraceEventCreateDataFragmented(uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const void* pvData, uint32_t uiSize)
+{
+	TraceUnsignedBaseType_t auxParams[2UL + TRC_EVENT_FRAGMENTED_MAX_PARAMS];
+	TraceEventFragment_t xFragment;
+	uint32_t uiFragmentSize;
+	uint32_t uiSequence;
+	uint32_t uiIndex;
+	uint32_t uiOffset;
+	uint32_t i;
+
+	/* This should never fail */
+	TRC_ASSERT((uiParamCount == 0u) || (puxParams != (void*)0));
+
+	/* This should never fail */
+	TRC_ASSERT((uiSize == 0u) || (pvData != (void*)0));
+
+	/* We need to check this */
+	if (uiParamCount > TRC_EVENT_FRAGMENTED_MAX_PARAMS)
+	{
+		return TRC_FAIL;
+	}
+
+	/* Each event holds the fragment info, the parameters and as much of the payload as fits */
+	uiFragmentSize = TRC_MAX_BLOB_SIZE - sizeof(TraceEvent0_t) - ((2u + uiParamCount) * sizeof(TraceUnsignedBaseType_t));
+
+	/* We need to check this */
+	if (uiSize > (TRC_EVENT_FRAGMENTED_MAX_COUNT * uiFragmentSize))
+	{
+		return TRC_FAIL;
+	}
+
+	/* We need to check this */
+	if (!xTraceIsRecorderEnabled())
+	{
+		return TRC_FAIL;
+	}
+
+	uiSequence = prvTraceEventNextFragmentSequence();
+
+	auxParams[1] = (TraceUnsignedBaseType_t)uiSize;
+	for (i = 0u; i < uiParamCount; i++)
+	{
+		auxParams[i + 2u] = puxParams[i];
+	}
+
+	uiIndex = 0u;
+	uiOffset = 0u;
+	do
+	{
+		xFragment.pvData = &((const uint8_t*)pvData)[uiOffset];
+		xFragment.uiSize = uiSize - uiOffset;
+		if (xFragment.uiSize > uiFragmentSize)
+		{
+			xFragment.uiSize = uiFragmentSize;
+		}
+
+		auxParams[0] = (TraceUnsignedBaseType_t)((uiSequence << 16) | uiIndex);
+
+		/* Every fragment is stored in its own critical section */
+		if (xTraceEventCreateDataV(uiEventCode, auxParams, 2u + uiParamCount, &xFragment, 1u) == TRC_FAIL)
+		{
+			return TRC_FAIL;
+		}
+
+		uiOffset += xFragment.uiSize;
+		uiIndex++;
+	} while (uiOffset < uiSize);
+
+	return TRC_SUCCESS;
+}
+#endif
+
+#if ((TRC_USE_INTERNAL_BUFFER == 1) && (TRC_INTERNAL_EVENT_BUFFER_WRITE_MODE == TRC_INTERNAL_EVENT_BUFFER_OPTION_WRITE_MODE_DIRECT)) || (TRC_EXTERNAL_BUFFERS == 1)
+/* The stream port allocates from an event buffer, so a whole batch is allocated at once */
+#define TRC_EVENT_BATCH_MAX_ALLOCATION (TRC_EVENT_BATCH_SIZE)
+#else
+/* The stream port allocates from a static buffer that holds one event */
+#define TRC_EVENT_BATCH_MAX_ALLOCATION (TRC_MAX_BLOB_SIZE)
+#endif
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+#define TRC_EVENT_BATCH_NEXT_EVENT_COUNT() prvTraceEventCounterIncrement()
+#else
+#define TRC_EVENT_BATCH_NEXT_EVENT_COUNT() (++pxTraceEventDataTable->coreEventData[TRC_CFG_GET_CURRENT_CORE()].eventCounter)
+#endif
+
+/**
+ * @internal Gets the size of the events in a batch that are allocated together.
+ *
+ * @param[in] pxBatch Pointer to batch.
+ * @param[in] uiOffset Offset of the first event.
+ * @param[out] puiEventCount Number of events.
+ *
+ * @returns The size of the events.
+ */
+static uint32_t prvTraceEventBatchGetAllocationSize(const TraceEventBatch_t* pxBatch, uint32_t uiOffset, uint32_t* puiEventCount)
+{
+	uint32_t uiSize = 0u;
+	uint32_t uiEventSize = 0u;
+
+	*puiEventCount = 0u;
+
+	while ((uiOffset + uiSize) < pxBatch->uiSize)
+	{
+		(void)TRC_EVENT_GET_SIZE(&((const uint8_t*)pxBatch->auxData)[uiOffset + uiSize], &uiEventSize); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+
+		if ((uiSize != 0u) && ((uiSize + uiEventSize) > (uint32_t)(TRC_EVENT_BATCH_MAX_ALLOCATION)))
+		{
+			break;
+		}
+
+		uiSize += uiEventSize;
+		(*puiEventCount)++;
+	}
+
+	return uiSize;
+}
+
+traceResult xTraceEventBatchBegin(TraceEventBatch_t* pxBatch)
+{
+	/* This should never fail */
+	TRC_ASSERT(pxBatch != (void*)0);
+
+	pxBatch->uiSize = 0u;
+	pxBatch->uiEventCount = 0u;
+
+	return TRC_SUCCESS;
+}
+
+traceResult xTraceEventBatchAddData(TraceEventBatch_t* pxBatch, uint32_t uiEventCode, const TraceUnsignedBaseType_t* puxParams, uint32_t uiParamCount, const void* pvData, uint32_t uiDataSize)
+{
+	TraceEvent0_t* pxEventData;
+	uint32_t uiParamSize;
+	uint32_t uiSize;
+
+	/* This should never fail */
+	TRC_ASSERT(pxBatch != (void*)0);
+
+	/* This should never fail */
+	TRC_ASSERT((uiParamCount == 0u) || (puxParams != (void*)0));
+
+	/* This should never fail */
+	TRC_ASSERT((uiDataSize == 0u) || (pvData != (void*)0));
+
+	uiParamSize = uiParamCount * sizeof(TraceUnsignedBaseType_t);
+
+	/* This should never fail */
+	TRC_ASSERT((sizeof(TraceEvent0_t) + uiParamSize) <= (uint32_t)(TRC_MAX_BLOB_SIZE));
+
+	TRACE_EVENT_FILTER()
+	TRACE_EVENT_TASK_EXCLUSION()
+
+	/* Truncate the payload in case it is too big */
+	if ((sizeof(TraceEvent0_t) + uiParamSize + TRC_ALIGN_CEIL(uiDataSize, sizeof(TraceUnsignedBaseType_t))) > (uint32_t)(TRC_MAX_BLOB_SIZE))
+	{
+		uiDataSize = (uint32_t)(TRC_MAX_BLOB_SIZE) - sizeof(TraceEvent0_t) - uiParamSize;
+	}
+
+	uiSize = sizeof(TraceEvent0_t) + uiParamSize + TRC_ALIGN_CEIL(uiDataSize, sizeof(TraceUnsignedBaseType_t));
+
+	/* We need to check this */
+	if ((pxBatch->uiSize + uiSize) > (uint32_t)(TRC_EVENT_BATCH_SIZE))
+	{
+		return TRC_FAIL;
+	}
+
+	pxEventData = (TraceEvent0_t*)&((uint8_t*)pxBatch->auxData)[pxBatch->uiSize]; /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress conversion between pointer types checks*/ /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+
+	/* The event count and timestamp are set by xTraceEventBatchEnd */
+	(void)memset(pxEventData, 0, uiSize);
+	pxEventData->EventID = TRC_EVENT_SET_PARAM_COUNT(uiEventCode, (uiSize - sizeof(TraceEvent0_t)) / sizeof(TraceUnsignedBaseType_t));
+
+	if (uiParamSize != 0u)
+	{
+		memcpy(&((uint8_t*)pxEventData)[sizeof(TraceEvent0_t)], puxParams, uiParamSize);
+	}
+
+	if (uiDataSize != 0u)
+	{
+		memcpy(&((uint8_t*)pxEventData)[sizeof(TraceEvent0_t) + uiParamSize], pvData, uiDataSize);
+	}
+
+	pxBatch->uiSize += uiSize;
+	pxBatch->uiEventCount++;
+
+	return TRC_SUCCESS;
+}
+
+traceResult xTraceEventBatchEnd(TraceEventBatch_t* pxBatch)
+{
+	uint8_t* puiData = (void*)0;
+	TraceEvent0_t* pxEventData;
+	uint32_t uiOffset = 0u;
+	uint32_t uiSize;
+	uint32_t uiEventCount = 0u;
+	uint32_t uiStoredEvents = 0u;
+	uint32_t uiEventSize = 0u;
+	uint32_t i;
+	int32_t iBytesCommitted = 0;
+	traceResult xResult = TRC_SUCCESS;
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	TraceCoreEventData_t* pxCoreEventData = &pxTraceEventDataTable->coreEventData[TRC_CFG_GET_CURRENT_CORE()];
+	uint16_t uiDelta;
+#else
+	uint32_t uiTimestamp = 0u;
+#endif
+
+	TRACE_EVENT_ALLOC_CRITICAL_SECTION();
+
+	/* This should never fail */
+	TRC_ASSERT(pxBatch != (void*)0);
+
+	if (pxBatch->uiEventCount == 0u)
+	{
+		return TRC_SUCCESS;
+	}
+
+	/* We need to check this */
+	if (!xTraceIsRecorderEnabled())
+	{
+		return TRC_FAIL;
+	}
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 0)
+	TRACE_ENTER_CRITICAL_SECTION();
+#endif
+
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 0)
+	(void)xTraceTimestampGet(&uiTimestamp);
+#endif
+
+	while (uiOffset < pxBatch->uiSize)
+	{
+		uiSize = prvTraceEventBatchGetAllocationSize(pxBatch, uiOffset, &uiEventCount);
+
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+		if (prvTraceEventAllocateCompact(uiSize, (void**)&puiData) == TRC_FAIL) /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/
+		{
+			/* The counter gap makes the next event store an extension */
+			xResult = TRC_FAIL;
+
+			break;
+		}
+
+		uiDelta = ((TraceEvent0_t*)puiData)->DTS; /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/
+#else
+		if (xTraceStreamPortAllocate(uiSize, (void**)&puiData) == TRC_FAIL) /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/
+		{
+			/* The events that are not stored leave a gap in the event counter */
+			for (; uiStoredEvents < pxBatch->uiEventCount; uiStoredEvents++)
+			{
+				(void)TRC_EVENT_BATCH_NEXT_EVENT_COUNT();
+			}
+
+			xResult = TRC_FAIL;
+
+			break;
+		}
+#endif
+
+		memcpy(puiData, &((uint8_t*)pxBatch->auxData)[uiOffset], uiSize);
+
+		pxEventData = (TraceEvent0_t*)puiData; /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/
+		for (i = 0u; i < uiEventCount; i++)
+		{
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+			/* Only the first event of an allocation has been counted and can have a delta */
+			if (i == 0u)
+			{
+				pxEventData->DTS = uiDelta;
+			}
+			else
+			{
+				pxCoreEventData->eventCounter++;
+			}
+#else
+#if (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+			pxEventData->CoreID = (uint16_t)TRC_CFG_GET_CURRENT_CORE();
+			TRC_EVENT_CLEAR_PADDING(pxEventData);
+#endif
+			pxEventData->EventCount = TRC_EVENT_SET_EVENT_COUNT(TRC_EVENT_BATCH_NEXT_EVENT_COUNT());
+			pxEventData->TS = uiTimestamp;
+#endif
+
+			(void)TRC_EVENT_GET_SIZE(pxEventData, &uiEventSize);
+			pxEventData = (TraceEvent0_t*)&((uint8_t*)pxEventData)[uiEventSize]; /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/ /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+		}
+
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+		pxCoreEventData->uiLastEventCounter = pxCoreEventData->eventCounter;
+#endif
+
+		(void)xTraceStreamPortCommit(puiData, uiSize, &iBytesCommitted);
+
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+		/* If the events were dropped when committed, the next event must store a timestamp extension */
+		if (iBytesCommitted == 0)
+		{
+			pxCoreEventData->uiLastEventCounter--;
+		}
+#endif
+
+		uiOffset += uiSize;
+		uiStoredEvents += uiEventCount;
+	}
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 0)
+	TRACE_EXIT_CRITICAL_SECTION();
+#endif
+
+	/* We need to use iBytesCommitted for the above call but do not use the value */
+	/* Remove potential warnings */
+	(void)iBytesCommitted;
+	(void)uiStoredEvents;
+
+	return xResult;
+}
+
 traceResult xTraceEventGetSize(const void* const pvAddress, uint32_t* puiSize)
 {
 	/* This should never fail */
@@ -517,4 +1271,68 @@ traceResult xTraceEventGetSize(const void* const pvAddress, uint32_t* puiSize)
 	return TRC_EVENT_GET_SIZE(pvAddress, puiSize);
 }
 
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+
+traceResult xTraceEventFilterExclude(uint32_t uiEventCode)
+{
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_EVENT));
+
+	/* We need to check this */
+	if (uiEventCode >= (uint32_t)(TRC_EVENT_FILTER_ID_COUNT))
+	{
+		return TRC_FAIL;
+	}
+
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	pxTraceEventDataTable->auiExcludedEvents[uiEventCode >> 5] |= (1UL << (uiEventCode & 0x1FUL));
+
+	TRACE_EXIT_CRITICAL_SECTION();
+
+	return TRC_SUCCESS;
+}
+
+traceResult xTraceEventFilterInclude(uint32_t uiEventCode)
+{
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_EVENT));
+
+	/* We need to check this */
+	if (uiEventCode >= (uint32_t)(TRC_EVENT_FILTER_ID_COUNT))
+	{
+		return TRC_FAIL;
+	}
+
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	pxTraceEventDataTable->auiExcludedEvents[uiEventCode >> 5] &= ~(1UL << (uiEventCode & 0x1FUL));
+
+	TRACE_EXIT_CRITICAL_SECTION();
+
+	return TRC_SUCCESS;
+}
+
+traceResult xTraceEventFilterIncludeAll(void)
+{
+	uint32_t i;
+
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_EVENT));
+
+	/* Each word is cleared in a single write, so no critical section is needed */
+	for (i = 0u; i < (uint32_t)(TRC_EVENT_FILTER_WORD_COUNT); i++)
+	{
+		pxTraceEventDataTable->auiExcludedEvents[i] = 0u;
+	}
+
+	return TRC_SUCCESS;
+}
+
+#endif
+
 #endif
@@ -12,6 +12,357 @@
 
 #if (TRC_USE_TRACEALYZER_RECORDER == 1) && (TRC_CFG_RECORDER_MODE == TRC_RECORDER_MODE_STREAMING)
 
+#if (TRC_CFG_EVENT_BUFFER_POWER_OF_TWO == 1)
+/* Buffer sizes are powers of two, so positions wrap using a mask instead of a division */
+#define TRC_EVENT_BUFFER_WRAP(uiPosition, uiBufferSize) ((uiPosition) & ((uiBufferSize) - 1UL))
+#else
+#define TRC_EVENT_BUFFER_WRAP(uiPosition, uiBufferSize) ((uiPosition) % (uiBufferSize))
+#endif
+
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+
+/* Marks a segment that no event starts in */
+#define TRC_EVENT_BUFFER_SEGMENT_NO_EVENT (0xFFFFU)
+
+/* Segment offsets must fit below TRC_EVENT_BUFFER_SEGMENT_NO_EVENT */
+#define TRC_EVENT_BUFFER_SEGMENT_MAX_SHIFT (15U)
+
+/**
+ * @brief Marks all segments of an Event Buffer as having no events.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ */
+static void prvTraceEventBufferIndexClear(TraceEventBuffer_t *pxTraceEventBuffer)
+{
+	uint32_t i;
+
+	for (i = 0u; i < (uint32_t)(TRC_CFG_EVENT_BUFFER_SEGMENTS); i++)
+	{
+		pxTraceEventBuffer->auiSegmentFirstEvent[i] = TRC_EVENT_BUFFER_SEGMENT_NO_EVENT;
+	}
+}
+
+/**
+ * @brief Updates the segment index for an event written to an Event Buffer.
+ *
+ * A segment is entered either by an event that starts at the segment start,
+ * which sets its entry, or by an event that spans the segment start, which
+ * clears its entry. The entry is then only set by the first event that
+ * starts in the segment.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiPosition Position of the event.
+ * @param[in] uiSize Size of the event.
+ */
+static void prvTraceEventBufferIndexEvent(TraceEventBuffer_t *pxTraceEventBuffer, uint32_t uiPosition, uint32_t uiSize)
+{
+	uint32_t uiSegmentSize = 1UL << pxTraceEventBuffer->uiSegmentShift;
+	uint32_t uiOffset = uiPosition & (uiSegmentSize - 1UL);
+	uint32_t uiSegmentStart = (uiPosition - uiOffset) + uiSegmentSize;
+	uint32_t uiEnd = uiPosition + uiSize;
+
+	if ((uiOffset == 0u) || (pxTraceEventBuffer->auiSegmentFirstEvent[uiPosition >> pxTraceEventBuffer->uiSegmentShift] == TRC_EVENT_BUFFER_SEGMENT_NO_EVENT))
+	{
+		pxTraceEventBuffer->auiSegmentFirstEvent[uiPosition >> pxTraceEventBuffer->uiSegmentShift] = (uint16_t)uiOffset;
+	}
+
+	/* No event starts in the segments that this event spans */
+	while (uiSegmentStart < uiEnd)
+	{
+		if (uiSegmentStart >= pxTraceEventBuffer->uiSize)
+		{
+			/* A pushed event that continues at the start of the buffer */
+			uiEnd -= pxTraceEventBuffer->uiSize;
+			uiSegmentStart = 0u;
+		}
+
+		pxTraceEventBuffer->auiSegmentFirstEvent[uiSegmentStart >> pxTraceEventBuffer->uiSegmentShift] = TRC_EVENT_BUFFER_SEGMENT_NO_EVENT;
+
+		uiSegmentStart += uiSegmentSize;
+	}
+}
+
+/**
+ * @brief Marks the segments that start in the slack area of an Event Buffer
+ * as having no events.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiPosition Start of the slack area.
+ */
+static void prvTraceEventBufferIndexSlack(TraceEventBuffer_t *pxTraceEventBuffer, uint32_t uiPosition)
+{
+	uint32_t uiSegmentSize = 1UL << pxTraceEventBuffer->uiSegmentShift;
+	uint32_t uiSegmentStart = (uiPosition + uiSegmentSize - 1UL) & ~(uiSegmentSize - 1UL);
+
+	while (uiSegmentStart < pxTraceEventBuffer->uiSize)
+	{
+		pxTraceEventBuffer->auiSegmentFirstEvent[uiSegmentStart >> pxTraceEventBuffer->uiSegmentShift] = TRC_EVENT_BUFFER_SEGMENT_NO_EVENT;
+
+		uiSegmentStart += uiSegmentSize;
+	}
+}
+
+/**
+ * @brief Frees all events up to the first event of the segment after the tail.
+ *
+ * Events in the segment of the tail, events that wrap at the end of the buffer
+ * and events that span a whole segment are instead popped one at a time by
+ * the caller.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiMaxSize Maximum number of bytes to free.
+ *
+ * @returns The number of bytes freed, 0 if none.
+ */
+static uint32_t prvTraceEventBufferSkipSegment(TraceEventBuffer_t *pxTraceEventBuffer, uint32_t uiMaxSize)
+{
+	uint32_t uiTail = pxTraceEventBuffer->uiTail;
+	uint32_t uiHead = pxTraceEventBuffer->uiHead;
+	uint32_t uiSegmentStart = ((uiTail >> pxTraceEventBuffer->uiSegmentShift) + 1UL) << pxTraceEventBuffer->uiSegmentShift;
+	uint32_t uiFirstEvent;
+	uint32_t uiSkipped;
+	uint32_t uiUsed;
+
+	if (uiSegmentStart >= pxTraceEventBuffer->uiSize)
+	{
+		return 0u;
+	}
+
+	uiFirstEvent = pxTraceEventBuffer->auiSegmentFirstEvent[uiSegmentStart >> pxTraceEventBuffer->uiSegmentShift];
+
+	if (uiFirstEvent == TRC_EVENT_BUFFER_SEGMENT_NO_EVENT)
+	{
+		return 0u;
+	}
+
+	uiSkipped = (uiSegmentStart + uiFirstEvent) - uiTail;
+	uiUsed = (uiHead >= uiTail) ? (uiHead - uiTail) : ((pxTraceEventBuffer->uiSize - uiTail) + uiHead);
+
+	/* Entries of segments past the head are from overwritten events */
+	if ((uiSkipped > uiMaxSize) || (uiSkipped > uiUsed))
+	{
+		return 0u;
+	}
+
+	pxTraceEventBuffer->uiTail = uiTail + uiSkipped;
+
+	return uiSkipped;
+}
+
+#endif
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+
+#ifndef TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32
+#error "TRC_CFG_LOCK_FREE_ALLOCATION requires TRC_CFG_ATOMIC_COMPARE_AND_SWAP_32 to be defined in trcConfig.h"
+#endif
+
+/* In lock-free mode uiNextHead holds the reservation offset in the lower 24 bits
+ * and the number of pending (uncommitted) allocations in the upper 8 bits. */
+#define TRC_EVENT_BUFFER_RESERVATION_OFFSET_MASK	(0x00FFFFFFUL)
+#define TRC_EVENT_BUFFER_RESERVATION_PENDING_SHIFT	(24U)
+#define TRC_EVENT_BUFFER_RESERVATION_PENDING_ONE	(1UL << TRC_EVENT_BUFFER_RESERVATION_PENDING_SHIFT)
+
+/**
+ * @brief Reserves a contiguous area in the Event Buffer without a critical section.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiSize Allocation size
+ * @param[out] ppvData Pointer that will hold the area from the buffer.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+static traceResult prvTraceEventBufferAllocLockFree(TraceEventBuffer_t *pxTraceEventBuffer, uint32_t uiSize, void **ppvData)
+{
+	uint32_t uiReservation;
+	uint32_t uiHead;
+	uint32_t uiTail;
+	uint32_t uiFreeSpace;
+	uint32_t uiOffset;
+	uint32_t uiNextHead;
+	uint32_t uiSlack;
+	uint32_t uiBufferSize = pxTraceEventBuffer->uiSize;
+
+	do
+	{
+		uiSlack = 0u;
+		uiReservation = pxTraceEventBuffer->uiNextHead;
+
+		/* This should never fail */
+		TRC_ASSERT((uiReservation >> TRC_EVENT_BUFFER_RESERVATION_PENDING_SHIFT) < 0xFFUL);
+
+		uiHead = uiReservation & TRC_EVENT_BUFFER_RESERVATION_OFFSET_MASK;
+		uiTail = pxTraceEventBuffer->uiTail;
+
+		if (uiHead >= uiTail)
+		{
+			uiFreeSpace = (uiBufferSize - uiHead - sizeof(uint32_t)) + uiTail;
+
+			if (uiFreeSpace < uiSize)
+			{
+				*ppvData = 0;
+
+				return TRC_FAIL;
+			}
+
+			if ((uiBufferSize - uiHead) > uiSize)
+			{
+				uiOffset = uiHead;
+				uiNextHead = uiHead + uiSize;
+			}
+			else
+			{
+				/* Wrap to the start of the buffer, making sure head and tail don't become equal */
+				if (uiTail <= uiSize)
+				{
+					*ppvData = 0;
+
+					return TRC_FAIL;
+				}
+
+				uiSlack = uiBufferSize - uiHead;
+				uiOffset = 0u;
+				uiNextHead = uiSize;
+			}
+		}
+		else
+		{
+			uiFreeSpace = uiTail - uiHead - sizeof(uint32_t);
+
+			if (uiFreeSpace < uiSize)
+			{
+				*ppvData = 0;
+
+				return TRC_FAIL;
+			}
+
+			uiOffset = uiHead;
+			uiNextHead = uiHead + uiSize;
+		}
+
+		/* If anyone else (e.g. a nested ISR) reserved space since we read the reservation, try again */
+	} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxTraceEventBuffer->uiNextHead, uiReservation, ((uiReservation & ~TRC_EVENT_BUFFER_RESERVATION_OFFSET_MASK) + TRC_EVENT_BUFFER_RESERVATION_PENDING_ONE) | uiNextHead) == 0);
+
+	/* The consumer will not read the slack until the wrapped head has been committed, which
+	 * cannot happen before this allocation is committed */
+	if (uiSlack != 0u)
+	{
+		pxTraceEventBuffer->uiSlack = uiSlack;
+	}
+
+	*ppvData = &pxTraceEventBuffer->puiBuffer[uiOffset]; /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+
+	return TRC_SUCCESS;
+}
+
+/**
+ * @brief Commits a lock-free allocation. The commit index (uiHead) is advanced
+ * when the last pending allocation is committed.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+static traceResult prvTraceEventBufferAllocCommitLockFree(TraceEventBuffer_t *pxTraceEventBuffer)
+{
+	uint32_t uiReservation;
+	uint32_t uiHead;
+
+	do
+	{
+		uiReservation = pxTraceEventBuffer->uiNextHead;
+
+		/* This should never fail */
+		TRC_ASSERT((uiReservation >> TRC_EVENT_BUFFER_RESERVATION_PENDING_SHIFT) != 0UL);
+	} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxTraceEventBuffer->uiNextHead, uiReservation, uiReservation - TRC_EVENT_BUFFER_RESERVATION_PENDING_ONE) == 0);
+
+	uiReservation -= TRC_EVENT_BUFFER_RESERVATION_PENDING_ONE;
+
+	/* Other allocations are still pending, the last one to commit will publish our data */
+	if ((uiReservation >> TRC_EVENT_BUFFER_RESERVATION_PENDING_SHIFT) != 0UL)
+	{
+		return TRC_SUCCESS;
+	}
+
+	/* Publish the data, unless a newer allocation has been made since. In that case
+	 * that allocation is responsible for publishing, and we must not move uiHead back. */
+	uiHead = pxTraceEventBuffer->uiHead;
+	while ((pxTraceEventBuffer->uiNextHead == uiReservation) &&
+		(TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxTraceEventBuffer->uiHead, uiHead, uiReservation & TRC_EVENT_BUFFER_RESERVATION_OFFSET_MASK) == 0))
+	{
+		uiHead = pxTraceEventBuffer->uiHead;
+	}
+
+	return TRC_SUCCESS;
+}
+
+#endif
+
+#if (TRC_CFG_EVENT_LOSS_RECORDS == 1)
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+#error "TRC_CFG_EVENT_LOSS_RECORDS can't be used together with TRC_CFG_LOCK_FREE_ALLOCATION"
+#endif
+
+#define TRC_EVENT_BUFFER_LOSS_RECORD_PUSH	(0U)
+#define TRC_EVENT_BUFFER_LOSS_RECORD_ALLOC	(1U)
+
+/* The events lost record has 4 parameters: events, bytes, first and last timestamp */
+#define TRC_EVENT_BUFFER_LOSS_RECORD_ID ((uint16_t)(((uint16_t)(PSF_EVENT_EVENTS_LOST)) | ((uint16_t)4U << 12)))
+
+#if (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+#define TRC_EVENT_BUFFER_LOSS_RECORD_COUNT(c) ((uint32_t)(c))
+#elif (TRC_CFG_CORE_COUNT > 1)
+#define TRC_EVENT_BUFFER_LOSS_RECORD_COUNT(c) ((uint16_t)(((TRC_CFG_GET_CURRENT_CORE() & 0xF) << 12) | ((uint16_t)(c) & 0xFFF)))
+#else
+#define TRC_EVENT_BUFFER_LOSS_RECORD_COUNT(c) ((uint16_t)(c))
+#endif
+
+#endif
+
+/**
+ * @brief Counts an event that was dropped since there was no room for it.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiSize Size of the dropped event.
+ */
+static void prvTraceEventBufferCountDropped(TraceEventBuffer_t *pxTraceEventBuffer, uint32_t uiSize)
+{
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+	uint32_t uiValue;
+
+	if (pxTraceEventBuffer->uiOptions == TRC_EVENT_BUFFER_OPTION_LOCK_FREE)
+	{
+		/* Other writers may drop events at the same time */
+		do
+		{
+			uiValue = pxTraceEventBuffer->uiDroppedEvents;
+		} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxTraceEventBuffer->uiDroppedEvents, uiValue, uiValue + 1u) == 0);
+
+		do
+		{
+			uiValue = pxTraceEventBuffer->uiDroppedBytes;
+		} while (TRC_PORT_ATOMIC_COMPARE_AND_SWAP_32(&pxTraceEventBuffer->uiDroppedBytes, uiValue, uiValue + uiSize) == 0);
+
+		return;
+	}
+#endif
+
+#if (TRC_CFG_EVENT_LOSS_RECORDS == 1)
+	(void)xTraceTimestampGet(&pxTraceEventBuffer->uiLastDropTimestamp);
+
+	if (pxTraceEventBuffer->uiDroppedEvents == pxTraceEventBuffer->uiReportedEvents)
+	{
+		pxTraceEventBuffer->uiFirstDropTimestamp = pxTraceEventBuffer->uiLastDropTimestamp;
+	}
+#endif
+
+	pxTraceEventBuffer->uiDroppedEvents++;
+	pxTraceEventBuffer->uiDroppedBytes += uiSize;
+}
+
 traceResult xTraceEventBufferInitialize(TraceEventBuffer_t* pxTraceEventBuffer, uint32_t uiOptions,
 	uint8_t* puiBuffer, uint32_t uiSize)
 {
@@ -24,6 +375,20 @@ traceResult xTraceEventBufferInitialize(TraceEventBuffer_t* pxTraceEventBuffer,
 	/* This should never fail */
 	TRC_ASSERT(uiSize != 0u);
 
+#if (TRC_CFG_EVENT_BUFFER_POWER_OF_TWO == 1)
+	/* This should never fail */
+	TRC_ASSERT((uiSize & (uiSize - 1u)) == 0u);
+#endif
+
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+	/* The reservation offset must fit in the lower bits of uiNextHead */
+	/* This should never fail */
+	TRC_ASSERT((uiOptions != TRC_EVENT_BUFFER_OPTION_LOCK_FREE) || (uiSize <= TRC_EVENT_BUFFER_RESERVATION_OFFSET_MASK));
+#else
+	/* This should never fail */
+	TRC_ASSERT(uiOptions != TRC_EVENT_BUFFER_OPTION_LOCK_FREE);
+#endif
+
 	pxTraceEventBuffer->uiOptions = uiOptions;
 	pxTraceEventBuffer->uiHead = 0u;
 	pxTraceEventBuffer->uiTail = 0u;
@@ -33,6 +398,34 @@ traceResult xTraceEventBufferInitialize(TraceEventBuffer_t* pxTraceEventBuffer,
 	pxTraceEventBuffer->uiSlack = 0u;
 	pxTraceEventBuffer->uiNextHead = 0u;
 	pxTraceEventBuffer->uiTimerWraparounds = 0u;
+	pxTraceEventBuffer->uiDroppedEvents = 0u;
+	pxTraceEventBuffer->uiDroppedBytes = 0u;
+#if (TRC_CFG_EVENT_LOSS_RECORDS == 1)
+	pxTraceEventBuffer->uiReportedEvents = 0u;
+	pxTraceEventBuffer->uiReportedBytes = 0u;
+	pxTraceEventBuffer->uiFirstDropTimestamp = 0u;
+	pxTraceEventBuffer->uiLastDropTimestamp = 0u;
+#endif
+#if (TRC_CFG_ORDERED_TRANSFER == 1)
+	pxTraceEventBuffer->uiUnorderedBytes = 0u;
+#endif
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+	/* Use the smallest segments that cover the buffer */
+	pxTraceEventBuffer->uiSegmentShift = 2u;
+	while (((uiSize + (1UL << pxTraceEventBuffer->uiSegmentShift) - 1UL) >> pxTraceEventBuffer->uiSegmentShift) > (uint32_t)(TRC_CFG_EVENT_BUFFER_SEGMENTS))
+	{
+		pxTraceEventBuffer->uiSegmentShift++;
+	}
+
+	/* We need to check this */
+	if (pxTraceEventBuffer->uiSegmentShift > TRC_EVENT_BUFFER_SEGMENT_MAX_SHIFT)
+	{
+		/* The buffer is too large for the configured number of segments */
+		return TRC_FAIL;
+	}
+
+	prvTraceEventBufferIndexClear(pxTraceEventBuffer);
+#endif
 
 	(void)xTraceSetComponentInitialized(TRC_RECORDER_COMPONENT_EVENT_BUFFER);
 
@@ -58,7 +451,7 @@ static traceResult prvTraceEventBufferPop(TraceEventBuffer_t *pxTraceEventBuffer
 	pxTraceEventBuffer->uiFree += uiFreeSize;
 
 	/* Update tail to point to the new last event */
-	pxTraceEventBuffer->uiTail = (pxTraceEventBuffer->uiTail + uiFreeSize) % pxTraceEventBuffer->uiSize;
+	pxTraceEventBuffer->uiTail = TRC_EVENT_BUFFER_WRAP(pxTraceEventBuffer->uiTail + uiFreeSize, pxTraceEventBuffer->uiSize);
 
 	return TRC_SUCCESS;
 }
@@ -82,17 +475,226 @@ static traceResult prvTraceEventBufferAllocPop(TraceEventBuffer_t *pxTraceEventB
 		TRC_ASSERT_ALWAYS_EVALUATE(xTraceEventGetSize(((void*)&(pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiTail])), &uiFreeSize) == TRC_SUCCESS); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
 
 		/* Update tail to point to the new last event */
-		pxTraceEventBuffer->uiTail = (pxTraceEventBuffer->uiTail + uiFreeSize) % pxTraceEventBuffer->uiSize;
+		pxTraceEventBuffer->uiTail = TRC_EVENT_BUFFER_WRAP(pxTraceEventBuffer->uiTail + uiFreeSize, pxTraceEventBuffer->uiSize);
 	}
 
 	return TRC_SUCCESS;
 }
 
-traceResult xTraceEventBufferAlloc(TraceEventBuffer_t *pxTraceEventBuffer, uint32_t uiSize, void **ppvData)
+/**
+ * @brief Allocates a contiguous area in an Event Buffer that skips new events when full.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiSize Allocation size
+ * @param[out] ppvData Pointer that will hold the area from the buffer.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+static traceResult prvTraceEventBufferAllocSkip(TraceEventBuffer_t *pxTraceEventBuffer, uint32_t uiSize, void **ppvData)
 {
 	uint32_t uiFreeSpace;
 	uint32_t uiHead;
 	uint32_t uiTail;
+	uint32_t uiBufferSize = pxTraceEventBuffer->uiSize;
+
+	/* Since a consumer could potentially update tail (free) during the procedure
+	 * we have to save it here to avoid problems with it changing during this call.
+	 */
+	uiHead = pxTraceEventBuffer->uiHead;
+	uiTail = TRC_PORT_LOAD_ACQUIRE_32(&pxTraceEventBuffer->uiTail);
+
+	if (uiHead >= uiTail)
+	{
+		uiFreeSpace = (uiBufferSize - uiHead - sizeof(uint32_t)) + uiTail;
+
+		if (uiFreeSpace < uiSize)
+		{
+			*ppvData = 0;
+
+			return TRC_FAIL;
+		}
+
+		/* Copy data */
+		if ((uiBufferSize - uiHead) > uiSize)
+		{
+			*ppvData = &pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiHead]; /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+
+			pxTraceEventBuffer->uiNextHead = TRC_EVENT_BUFFER_WRAP(uiHead + uiSize, uiBufferSize);
+		}
+		else
+		{
+			uiFreeSpace = uiTail;
+
+			if (uiFreeSpace < uiSize)
+			{
+				*ppvData = 0;
+
+				return TRC_FAIL;
+			}
+
+			/* Calculate slack */
+			pxTraceEventBuffer->uiSlack = uiBufferSize - uiHead;
+
+			*ppvData = pxTraceEventBuffer->puiBuffer;
+
+			pxTraceEventBuffer->uiNextHead = TRC_EVENT_BUFFER_WRAP(uiHead + pxTraceEventBuffer->uiSlack + uiSize, uiBufferSize);
+		}
+	}
+	else
+	{
+		uiFreeSpace = uiTail - uiHead - sizeof(uint32_t);
+
+		if (uiFreeSpace < uiSize)
+		{
+			*ppvData = 0;
+
+			return TRC_FAIL;
+		}
+
+		/* Alloc data */
+		*ppvData = &pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiHead]; /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+
+		pxTraceEventBuffer->uiNextHead = (uiHead + uiSize);
+	}
+
+	return TRC_SUCCESS;
+}
+
+/**
+ * @brief Copies data into an Event Buffer that skips new events when full.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] pvData Pointer to data.
+ * @param[in] uiSize Size of data.
+ *
+ * @retval TRC_FAIL There was no room for the data
+ * @retval TRC_SUCCESS Success
+ */
+static traceResult prvTraceEventBufferPushSkip(TraceEventBuffer_t *pxTraceEventBuffer, void *pvData, uint32_t uiSize)
+{
+	uint32_t uiBufferSize = pxTraceEventBuffer->uiSize;
+	uint32_t uiHead;
+	uint32_t uiTail;
+	uint32_t uiFreeSpace;
+
+	/* Since a consumer could potentially update tail (free) during the procedure
+	 * we have to save it here to avoid problems with the push algorithm.
+	 */
+	uiHead = pxTraceEventBuffer->uiHead;
+	uiTail = TRC_PORT_LOAD_ACQUIRE_32(&pxTraceEventBuffer->uiTail);
+
+	if (uiHead >= uiTail)
+	{
+		uiFreeSpace = (uiBufferSize - uiHead - sizeof(uint32_t)) + uiTail;
+
+		if (uiFreeSpace < uiSize)
+		{
+			return TRC_FAIL;
+		}
+
+		/* Copy data */
+		if ((uiBufferSize - uiHead) > uiSize)
+		{
+			TRC_MEMCPY(&pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiHead], pvData, uiSize); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+		}
+		else
+		{
+			TRC_MEMCPY(&pxTraceEventBuffer->puiBuffer[uiHead], pvData, (uiBufferSize - uiHead)); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+			TRC_MEMCPY(pxTraceEventBuffer->puiBuffer, (void*)(&((uint8_t*)pvData)[(uiBufferSize - uiHead)]), (uiSize - (uiBufferSize - uiHead)));  /*cstat !MISRAC2012-Rule-11.5 Suppress pointer checks*/ /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+		}
+
+		/* Publish the data to the consumer */
+		TRC_PORT_STORE_RELEASE_32(&pxTraceEventBuffer->uiHead, TRC_EVENT_BUFFER_WRAP(uiHead + uiSize, uiBufferSize));
+	}
+	else
+	{
+		uiFreeSpace = uiTail - uiHead - sizeof(uint32_t);
+
+		if (uiFreeSpace < uiSize)
+		{
+			return TRC_FAIL;
+		}
+
+		/* Copy data */
+		TRC_MEMCPY(&pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiHead], pvData, uiSize); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+
+		/* Publish the data to the consumer */
+		TRC_PORT_STORE_RELEASE_32(&pxTraceEventBuffer->uiHead, uiHead + uiSize);
+	}
+
+	return TRC_SUCCESS;
+}
+
+#if (TRC_CFG_EVENT_LOSS_RECORDS == 1)
+/**
+ * @brief Stores an events lost record for the events dropped since the last record.
+ *
+ * The record is only stored if there is room for it. Otherwise it is stored
+ * after a later event.
+ *
+ * @param[in] pxTraceEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiMethod TRC_EVENT_BUFFER_LOSS_RECORD_PUSH if the buffer is written
+ * using xTraceEventBufferPush, TRC_EVENT_BUFFER_LOSS_RECORD_ALLOC if it is
+ * written using xTraceEventBufferAlloc.
+ */
+static void prvTraceEventBufferStoreLossRecord(TraceEventBuffer_t *pxTraceEventBuffer, uint32_t uiMethod)
+{
+	TraceEvent4_t xRecord;
+	TraceEvent4_t* pxRecord = &xRecord;
+	uint32_t uiDroppedEvents = pxTraceEventBuffer->uiDroppedEvents;
+	uint32_t uiDroppedBytes = pxTraceEventBuffer->uiDroppedBytes;
+
+	if (uiMethod == TRC_EVENT_BUFFER_LOSS_RECORD_ALLOC)
+	{
+		/* We need to check this */
+		if (prvTraceEventBufferAllocSkip(pxTraceEventBuffer, sizeof(TraceEvent4_t), (void**)&pxRecord) == TRC_FAIL) /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress pointer checks*/
+		{
+			return;
+		}
+	}
+
+	pxRecord->EventID = TRC_EVENT_BUFFER_LOSS_RECORD_ID;
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+	/* The record holds its own timestamps, the timestamp delta of the next event is relative to the event before it */
+	pxRecord->DTS = 0u;
+#else
+#if (TRC_CFG_EXTENDED_EVENT_HEADER == 1)
+	pxRecord->CoreID = (uint16_t)TRC_CFG_GET_CURRENT_CORE();
+#if (TRC_BASE_TYPE_SIZE == 8)
+	pxRecord->Padding = 0u;
+#endif
+#endif
+	/* The record repeats the event count of the last event, so it is not mistaken for another lost event */
+	pxRecord->EventCount = TRC_EVENT_BUFFER_LOSS_RECORD_COUNT(pxTraceEventDataTable->coreEventData[TRC_CFG_GET_CURRENT_CORE()].eventCounter);
+	(void)xTraceTimestampGet(&pxRecord->TS);
+#endif
+	pxRecord->uxParams[0] = (TraceUnsignedBaseType_t)(uiDroppedEvents - pxTraceEventBuffer->uiReportedEvents);
+	pxRecord->uxParams[1] = (TraceUnsignedBaseType_t)(uiDroppedBytes - pxTraceEventBuffer->uiReportedBytes);
+	pxRecord->uxParams[2] = (TraceUnsignedBaseType_t)pxTraceEventBuffer->uiFirstDropTimestamp;
+	pxRecord->uxParams[3] = (TraceUnsignedBaseType_t)pxTraceEventBuffer->uiLastDropTimestamp;
+
+	if (uiMethod == TRC_EVENT_BUFFER_LOSS_RECORD_ALLOC)
+	{
+		TRC_PORT_STORE_RELEASE_32(&pxTraceEventBuffer->uiHead, pxTraceEventBuffer->uiNextHead);
+	}
+	else
+	{
+		/* We need to check this */
+		if (prvTraceEventBufferPushSkip(pxTraceEventBuffer, pxRecord, sizeof(TraceEvent4_t)) == TRC_FAIL)
+		{
+			return;
+		}
+	}
+
+	pxTraceEventBuffer->uiReportedEvents = uiDroppedEvents;
+	pxTraceEventBuffer->uiReportedBytes = uiDroppedBytes;
+}
+#endif
+
+traceResult xTraceEventBufferAlloc(TraceEventBuffer_t *pxTraceEventBuffer, uint32_t uiSize, void **ppvData)
+{
+	uint32_t uiFreeSpace;
 	uint32_t uiBufferSize;
 
 	/* This should never fail */
@@ -109,6 +711,21 @@ traceResult xTraceEventBufferAlloc(TraceEventBuffer_t *pxTraceEventBuffer, uint3
 	/* This should never fail */
 	TRC_ASSERT(uiSize <= uiBufferSize);
 
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+	if (pxTraceEventBuffer->uiOptions == TRC_EVENT_BUFFER_OPTION_LOCK_FREE)
+	{
+		/* We need to check this */
+		if (prvTraceEventBufferAllocLockFree(pxTraceEventBuffer, uiSize, ppvData) == TRC_FAIL)
+		{
+			prvTraceEventBufferCountDropped(pxTraceEventBuffer, uiSize);
+
+			return TRC_FAIL;
+		}
+
+		return TRC_SUCCESS;
+	}
+#endif
+
 	/* Handle overwrite buffer allocation, since this kind of allocation modifies
 	 * both head and tail it should only be used for internal buffers without any
 	 * flushing calls (Streaming Ringbuffer)
@@ -121,7 +738,7 @@ traceResult xTraceEventBufferAlloc(TraceEventBuffer_t *pxTraceEventBuffer, uint3
 			if ((uiBufferSize - pxTraceEventBuffer->uiHead) > uiSize)
 			{
 				*ppvData = &pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiHead]; /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
-				pxTraceEventBuffer->uiNextHead = (pxTraceEventBuffer->uiHead  + uiSize) % uiBufferSize;
+				pxTraceEventBuffer->uiNextHead = TRC_EVENT_BUFFER_WRAP(pxTraceEventBuffer->uiHead + uiSize, uiBufferSize);
 			}
 			/* There wasn't enough space for a direct alloc, handle freeing up
 			 * space and wrapping. */
@@ -131,10 +748,19 @@ traceResult xTraceEventBufferAlloc(TraceEventBuffer_t *pxTraceEventBuffer, uint3
 				 * allocation */
 				do
 				{
-					(void)prvTraceEventBufferAllocPop(pxTraceEventBuffer);
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+					if ((pxTraceEventBuffer->uiTail >= (uiSize + sizeof(uint32_t))) || (prvTraceEventBufferSkipSegment(pxTraceEventBuffer, (uiSize + sizeof(uint32_t)) - pxTraceEventBuffer->uiTail) == 0u))
+#endif
+					{
+						(void)prvTraceEventBufferAllocPop(pxTraceEventBuffer);
+					}
 					uiFreeSpace = pxTraceEventBuffer->uiTail - sizeof(uint32_t);
 				} while (uiFreeSpace < uiSize);
 
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+				prvTraceEventBufferIndexSlack(pxTraceEventBuffer, pxTraceEventBuffer->uiHead);
+#endif
+
 				/* Calculate slack from the wrapping */
 				pxTraceEventBuffer->uiSlack = uiBufferSize - pxTraceEventBuffer->uiHead;
 
@@ -144,7 +770,7 @@ traceResult xTraceEventBufferAlloc(TraceEventBuffer_t *pxTraceEventBuffer, uint3
 				/* Allocate data */
 				*ppvData = pxTraceEventBuffer->puiBuffer;
 
-				pxTraceEventBuffer->uiNextHead = (pxTraceEventBuffer->uiHead  + uiSize) % uiBufferSize;
+				pxTraceEventBuffer->uiNextHead = TRC_EVENT_BUFFER_WRAP(pxTraceEventBuffer->uiHead + uiSize, uiBufferSize);
 			}
 		}
 		else
@@ -165,13 +791,22 @@ traceResult xTraceEventBufferAlloc(TraceEventBuffer_t *pxTraceEventBuffer, uint3
 						(void)prvTraceEventBufferAllocPop(pxTraceEventBuffer);
 					} while (pxTraceEventBuffer->uiTail == 0u);
 
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+					prvTraceEventBufferIndexSlack(pxTraceEventBuffer, pxTraceEventBuffer->uiHead);
+#endif
+
 					pxTraceEventBuffer->uiSlack = pxTraceEventBuffer->uiSize - pxTraceEventBuffer->uiHead;
 					pxTraceEventBuffer->uiHead = 0u;
 				}
 				
 				do
 				{
-					(void)prvTraceEventBufferAllocPop(pxTraceEventBuffer);
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+					if ((pxTraceEventBuffer->uiTail >= (pxTraceEventBuffer->uiHead + uiSize + sizeof(uint32_t))) || (prvTraceEventBufferSkipSegment(pxTraceEventBuffer, (pxTraceEventBuffer->uiHead + uiSize + sizeof(uint32_t)) - pxTraceEventBuffer->uiTail) == 0u))
+#endif
+					{
+						(void)prvTraceEventBufferAllocPop(pxTraceEventBuffer);
+					}
 					uiFreeSpace = pxTraceEventBuffer->uiTail - pxTraceEventBuffer->uiHead - sizeof(uint32_t);
 				} while (uiFreeSpace < uiSize);
 
@@ -186,67 +821,19 @@ traceResult xTraceEventBufferAlloc(TraceEventBuffer_t *pxTraceEventBuffer, uint3
 
 			pxTraceEventBuffer->uiNextHead = (pxTraceEventBuffer->uiHead + uiSize);
 		}
+
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+		prvTraceEventBufferIndexEvent(pxTraceEventBuffer, pxTraceEventBuffer->uiHead, uiSize);
+#endif
 	}
 	else
 	{
-		/* Since a consumer could potentially update tail (free) during the procedure
-		 * we have to save it here to avoid problems with it changing during this call.
-		 */
-		uiHead = pxTraceEventBuffer->uiHead;
-		uiTail = pxTraceEventBuffer->uiTail;
-
-		if (uiHead >= uiTail)
+		/* We need to check this */
+		if (prvTraceEventBufferAllocSkip(pxTraceEventBuffer, uiSize, ppvData) == TRC_FAIL)
 		{
-			uiFreeSpace = (uiBufferSize - uiHead - sizeof(uint32_t)) + uiTail;
-
-			if (uiFreeSpace < uiSize)
-			{
-				*ppvData = 0;
-
-				return TRC_FAIL;
-			}
-
-			/* Copy data */
-			if ((uiBufferSize - uiHead) > uiSize)
-			{
-				*ppvData = &pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiHead]; /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
-
-				pxTraceEventBuffer->uiNextHead = (uiHead + uiSize) % uiBufferSize;
-			}
-			else
-			{
-				uiFreeSpace = uiTail;
+			prvTraceEventBufferCountDropped(pxTraceEventBuffer, uiSize);
 
-				if (uiFreeSpace < uiSize)
-				{
-					*ppvData = 0;
-
-					return TRC_FAIL;
-				}
-
-				/* Calculate slack */
-				pxTraceEventBuffer->uiSlack = uiBufferSize - uiHead;
-
-				*ppvData = pxTraceEventBuffer->puiBuffer;
-
-				pxTraceEventBuffer->uiNextHead = (uiHead + pxTraceEventBuffer->uiSlack + uiSize) % uiBufferSize;
-			}
-		}
-		else
-		{
-			uiFreeSpace = uiTail - uiHead - sizeof(uint32_t);
-
-			if (uiFreeSpace < uiSize)
-			{
-				*ppvData = 0;
-
-				return TRC_FAIL;
-			}
-
-			/* Alloc data */
-			*ppvData = &pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiHead]; /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
-
-			pxTraceEventBuffer->uiNextHead = (uiHead + uiSize);
+			return TRC_FAIL;
 		}
 	}
 
@@ -260,12 +847,26 @@ traceResult xTraceEventBufferAllocCommit(TraceEventBuffer_t *pxTraceEventBuffer,
 	/* This should never fail */
 	TRC_ASSERT_ALWAYS_EVALUATE(xTraceTimestampGetWraparounds(&pxTraceEventBuffer->uiTimerWraparounds) == TRC_SUCCESS);
 
-	/* Advance head location */
-	pxTraceEventBuffer->uiHead = pxTraceEventBuffer->uiNextHead;
-
 	/* Update bytes written */
 	*piBytesWritten = (int32_t)uiSize;
 
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+	if (pxTraceEventBuffer->uiOptions == TRC_EVENT_BUFFER_OPTION_LOCK_FREE)
+	{
+		return prvTraceEventBufferAllocCommitLockFree(pxTraceEventBuffer);
+	}
+#endif
+
+	/* Advance head location, publishing the event (and any slack) to the consumer */
+	TRC_PORT_STORE_RELEASE_32(&pxTraceEventBuffer->uiHead, pxTraceEventBuffer->uiNextHead);
+
+#if (TRC_CFG_EVENT_LOSS_RECORDS == 1)
+	if ((pxTraceEventBuffer->uiOptions == TRC_EVENT_BUFFER_OPTION_SKIP) && (pxTraceEventBuffer->uiDroppedEvents != pxTraceEventBuffer->uiReportedEvents))
+	{
+		prvTraceEventBufferStoreLossRecord(pxTraceEventBuffer, TRC_EVENT_BUFFER_LOSS_RECORD_ALLOC);
+	}
+#endif
+
 	return TRC_SUCCESS;
 }
 
@@ -273,8 +874,12 @@ traceResult xTraceEventBufferPush(TraceEventBuffer_t *pxTraceEventBuffer, void *
 {
 	uint32_t uiBufferSize;
 	uint32_t uiHead;
-	uint32_t uiTail;
-	uint32_t uiFreeSpace;
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+	void *pvAllocation = (void*)0;
+#endif
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+	uint32_t uiSkipped;
+#endif
 	
 	/* This should never fail */
 	TRC_ASSERT(pxTraceEventBuffer != (void*)0);
@@ -315,6 +920,15 @@ traceResult xTraceEventBufferPush(TraceEventBuffer_t *pxTraceEventBuffer, void *
 			/* If there isn't enough space in the buffer pop events until there is */
 			while (pxTraceEventBuffer->uiFree < uiSize)
 			{
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+				uiSkipped = prvTraceEventBufferSkipSegment(pxTraceEventBuffer, uiSize - pxTraceEventBuffer->uiFree);
+				if (uiSkipped != 0u)
+				{
+					pxTraceEventBuffer->uiFree += uiSkipped;
+
+					continue;
+				}
+#endif
 				(void)prvTraceEventBufferPop(pxTraceEventBuffer);
 			}
 
@@ -331,60 +945,49 @@ traceResult xTraceEventBufferPush(TraceEventBuffer_t *pxTraceEventBuffer, void *
 
 			pxTraceEventBuffer->uiFree -= uiSize;
 
-			pxTraceEventBuffer->uiHead = (uiHead + uiSize) % uiBufferSize;
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+			prvTraceEventBufferIndexEvent(pxTraceEventBuffer, uiHead, uiSize);
+#endif
+
+			pxTraceEventBuffer->uiHead = TRC_EVENT_BUFFER_WRAP(uiHead + uiSize, uiBufferSize);
 
 			*piBytesWritten = (int32_t)uiSize;
 			break;
 		case TRC_EVENT_BUFFER_OPTION_SKIP:
-			/* Since a consumer could potentially update tail (free) during the procedure
-			 * we have to save it here to avoid problems with the push algorithm.
-			 */
-			uiHead = pxTraceEventBuffer->uiHead;
-			uiTail = pxTraceEventBuffer->uiTail;
-
-			if (uiHead >= uiTail)
+			/* We need to check this */
+			if (prvTraceEventBufferPushSkip(pxTraceEventBuffer, pvData, uiSize) == TRC_FAIL)
 			{
-				uiFreeSpace = (uiBufferSize - uiHead - sizeof(uint32_t)) + uiTail;
+				prvTraceEventBufferCountDropped(pxTraceEventBuffer, uiSize);
 
-				if (uiFreeSpace < uiSize)
-				{
-					*piBytesWritten = 0;
-
-					return TRC_SUCCESS;
-				}
+				return TRC_SUCCESS;
+			}
 
-				/* Copy data */
-				if ((uiBufferSize - uiHead) > uiSize)
-				{
-					TRC_MEMCPY(&pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiHead], pvData, uiSize); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
-				}
-				else
-				{
-					TRC_MEMCPY(&pxTraceEventBuffer->puiBuffer[uiHead], pvData, (uiBufferSize - uiHead)); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
-					TRC_MEMCPY(pxTraceEventBuffer->puiBuffer, (void*)(&((uint8_t*)pvData)[(uiBufferSize - uiHead)]), (uiSize - (uiBufferSize - uiHead)));  /*cstat !MISRAC2012-Rule-11.5 Suppress pointer checks*/ /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
-				}
+			*piBytesWritten = (int32_t)uiSize;
 
-				pxTraceEventBuffer->uiHead = (uiHead + uiSize) % uiBufferSize;
+#if (TRC_CFG_EVENT_LOSS_RECORDS == 1)
+			if (pxTraceEventBuffer->uiDroppedEvents != pxTraceEventBuffer->uiReportedEvents)
+			{
+				prvTraceEventBufferStoreLossRecord(pxTraceEventBuffer, TRC_EVENT_BUFFER_LOSS_RECORD_PUSH);
 			}
-			else
+#endif
+			break;
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+		case TRC_EVENT_BUFFER_OPTION_LOCK_FREE:
+			/* Skip the event if there is no room, just like TRC_EVENT_BUFFER_OPTION_SKIP */
+			if (prvTraceEventBufferAllocLockFree(pxTraceEventBuffer, uiSize, &pvAllocation) == TRC_FAIL)
 			{
-				uiFreeSpace = uiTail - uiHead - sizeof(uint32_t);
+				prvTraceEventBufferCountDropped(pxTraceEventBuffer, uiSize);
 
-				if (uiFreeSpace < uiSize)
-				{
-					*piBytesWritten = 0;
-
-					return TRC_SUCCESS;
-				}
+				return TRC_SUCCESS;
+			}
 
-				/* Copy data */
-				TRC_MEMCPY(&pxTraceEventBuffer->puiBuffer[pxTraceEventBuffer->uiHead], pvData, uiSize); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+			TRC_MEMCPY(pvAllocation, pvData, uiSize);
 
-				pxTraceEventBuffer->uiHead = (uiHead + uiSize);
-			}
+			(void)prvTraceEventBufferAllocCommitLockFree(pxTraceEventBuffer);
 
 			*piBytesWritten = (int32_t)uiSize;
 			break;
+#endif
 		default:
 			return TRC_FAIL;
 	}
@@ -406,7 +1009,8 @@ traceResult xTraceEventBufferTransferAll(TraceEventBuffer_t* pxTraceEventBuffer,
 	/* This should never fail */
 	TRC_ASSERT(piBytesWritten != (void*)0);
 
-	uiHead = pxTraceEventBuffer->uiHead;
+	/* The head is published after the event data and slack are written */
+	uiHead = TRC_PORT_LOAD_ACQUIRE_32(&pxTraceEventBuffer->uiHead);
 	uiTail = pxTraceEventBuffer->uiTail;
 	uiSlack = pxTraceEventBuffer->uiSlack;
 
@@ -436,7 +1040,7 @@ traceResult xTraceEventBufferTransferAll(TraceEventBuffer_t* pxTraceEventBuffer,
 		if ((uint32_t)iBytesWritten == (pxTraceEventBuffer->uiSize - uiTail - uiSlack))
 		{
 			/* uiTail is moved to start of buffer */
-			pxTraceEventBuffer->uiTail = 0u;
+			TRC_PORT_STORE_RELEASE_32(&pxTraceEventBuffer->uiTail, 0u);
 
 			iSumBytesWritten = iBytesWritten;
 
@@ -450,8 +1054,8 @@ traceResult xTraceEventBufferTransferAll(TraceEventBuffer_t* pxTraceEventBuffer,
 		}
 	}
 	
-	/* Move tail */
-	pxTraceEventBuffer->uiTail += (uint32_t)iBytesWritten;
+	/* Move tail, releasing the space to the producer once the data has been read */
+	TRC_PORT_STORE_RELEASE_32(&pxTraceEventBuffer->uiTail, pxTraceEventBuffer->uiTail + (uint32_t)iBytesWritten);
 	
 	iSumBytesWritten += iBytesWritten;
 
@@ -474,7 +1078,8 @@ traceResult xTraceEventBufferTransferChunk(TraceEventBuffer_t* pxTraceEventBuffe
 	/* This should never fail */
 	TRC_ASSERT(piBytesWritten != (void*)0);
 
-	uiHead = pxTraceEventBuffer->uiHead;
+	/* The head is published after the event data and slack are written */
+	uiHead = TRC_PORT_LOAD_ACQUIRE_32(&pxTraceEventBuffer->uiHead);
 	uiTail = pxTraceEventBuffer->uiTail;
 	uiSlack = pxTraceEventBuffer->uiSlack;
 
@@ -498,7 +1103,7 @@ traceResult xTraceEventBufferTransferChunk(TraceEventBuffer_t* pxTraceEventBuffe
 
 		(void)xTraceStreamPortWriteData(&pxTraceEventBuffer->puiBuffer[uiTail], uiBytesToWrite, &iBytesWritten); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
 
-		pxTraceEventBuffer->uiTail += (uint32_t)iBytesWritten;
+		TRC_PORT_STORE_RELEASE_32(&pxTraceEventBuffer->uiTail, uiTail + (uint32_t)iBytesWritten);
 	}
 	else
 	{
@@ -515,11 +1120,11 @@ traceResult xTraceEventBufferTransferChunk(TraceEventBuffer_t* pxTraceEventBuffe
 		 * segment, reset tail to 0. */
 		if ((uiTail + (uint32_t)iBytesWritten) == (pxTraceEventBuffer->uiSize - uiSlack))
 		{
-			pxTraceEventBuffer->uiTail = 0u;
+			TRC_PORT_STORE_RELEASE_32(&pxTraceEventBuffer->uiTail, 0u);
 		}
 		else
 		{
-			pxTraceEventBuffer->uiTail += (uint32_t)iBytesWritten;
+			TRC_PORT_STORE_RELEASE_32(&pxTraceEventBuffer->uiTail, uiTail + (uint32_t)iBytesWritten);
 		}
 	}
 
@@ -539,6 +1144,35 @@ traceResult xTraceEventBufferClear(TraceEventBuffer_t* pxTraceEventBuffer)
 	pxTraceEventBuffer->uiSlack = 0u;
 	pxTraceEventBuffer->uiNextHead = 0u;
 
+#if (TRC_CFG_EVENT_LOSS_RECORDS == 1)
+	/* Events dropped before the buffer was cleared are still counted, but not reported */
+	pxTraceEventBuffer->uiReportedEvents = pxTraceEventBuffer->uiDroppedEvents;
+	pxTraceEventBuffer->uiReportedBytes = pxTraceEventBuffer->uiDroppedBytes;
+#endif
+#if (TRC_CFG_ORDERED_TRANSFER == 1)
+	pxTraceEventBuffer->uiUnorderedBytes = 0u;
+#endif
+#if (TRC_CFG_EVENT_BUFFER_SEGMENTS > 0)
+	prvTraceEventBufferIndexClear(pxTraceEventBuffer);
+#endif
+
+	return TRC_SUCCESS;
+}
+
+traceResult xTraceEventBufferGetDropped(const TraceEventBuffer_t* pxTraceEventBuffer, uint32_t* puiDroppedEvents, uint32_t* puiDroppedBytes)
+{
+	/* This should never fail */
+	TRC_ASSERT(pxTraceEventBuffer != (void*)0);
+
+	/* This should never fail */
+	TRC_ASSERT(puiDroppedEvents != (void*)0);
+
+	/* This should never fail */
+	TRC_ASSERT(puiDroppedBytes != (void*)0);
+
+	*puiDroppedEvents = pxTraceEventBuffer->uiDroppedEvents;
+	*puiDroppedBytes = pxTraceEventBuffer->uiDroppedBytes;
+
 	return TRC_SUCCESS;
 }
 
@@ -16,6 +16,15 @@
 #include <string.h>
 #include <stdarg.h>
 
+#if (TRC_CFG_LOCK_FREE_ALLOCATION == 1)
+#if (TRC_INTERNAL_EVENT_BUFFER_WRITE_MODE != TRC_INTERNAL_EVENT_BUFFER_OPTION_WRITE_MODE_DIRECT)
+#error "TRC_CFG_LOCK_FREE_ALLOCATION requires TRC_INTERNAL_EVENT_BUFFER_OPTION_WRITE_MODE_DIRECT"
+#endif
+#define TRC_INTERNAL_EVENT_BUFFER_OPTIONS TRC_EVENT_BUFFER_OPTION_LOCK_FREE
+#else
+#define TRC_INTERNAL_EVENT_BUFFER_OPTIONS TRC_EVENT_BUFFER_OPTION_SKIP
+#endif
+
 static TraceMultiCoreEventBuffer_t *pxInternalEventBuffer TRC_CFG_RECORDER_DATA_ATTRIBUTE;
 
 traceResult xTraceInternalEventBufferInitialize(uint8_t* puiBuffer, uint32_t uiSize)
@@ -29,7 +38,7 @@ traceResult xTraceInternalEventBufferInitialize(uint8_t* puiBuffer, uint32_t uiS
 
 	/* Send in a an address pointing after the TraceMultiCoreEventBuffer_t */
 	/* We need to check this */
-	if (xTraceMultiCoreEventBufferInitialize(pxInternalEventBuffer, TRC_EVENT_BUFFER_OPTION_SKIP,
+	if (xTraceMultiCoreEventBufferInitialize(pxInternalEventBuffer, TRC_INTERNAL_EVENT_BUFFER_OPTIONS,
 		&puiBuffer[sizeof(TraceMultiCoreEventBuffer_t)], uiSize - sizeof(TraceMultiCoreEventBuffer_t)) == TRC_FAIL)
 	{
 		return TRC_FAIL;
@@ -106,4 +115,12 @@ traceResult xTraceInternalEventBufferClear()
 	return xTraceMultiCoreEventBufferClear(pxInternalEventBuffer);
 }
 
+traceResult xTraceInternalEventBufferMarkUnordered()
+{
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_INTERNAL_EVENT_BUFFER));
+
+	return xTraceMultiCoreEventBufferMarkUnordered(pxInternalEventBuffer);
+}
+
 #endif
@@ -12,11 +12,33 @@
 
 #if (TRC_USE_TRACEALYZER_RECORDER == 1) && (TRC_CFG_RECORDER_MODE == TRC_RECORDER_MODE_STREAMING)
 
+#ifdef TRC_CFG_CORE_BUFFER_WEIGHTS
+/* The share of the buffer that each core gets, relative to the sum of all weights */
+static const uint32_t auiCoreBufferWeights[] = TRC_CFG_CORE_BUFFER_WEIGHTS;
+
+/* Fails to compile unless TRC_CFG_CORE_BUFFER_WEIGHTS has one weight per core */
+typedef uint8_t TraceMultiCoreEventBufferWeightCountCheck_t[((sizeof(auiCoreBufferWeights) / sizeof(auiCoreBufferWeights[0])) == (uint32_t)(TRC_CFG_CORE_COUNT)) ? 1 : -1];
+#endif
+
+/* The event buffer of each core starts on a cache line of its own if TRC_CFG_CACHE_LINE_SIZE is set */
+#if (TRC_CFG_CACHE_LINE_SIZE > 0)
+#define TRC_MULTI_CORE_EVENT_BUFFER_ALIGNMENT ((uint32_t)(TRC_CFG_CACHE_LINE_SIZE))
+#else
+#define TRC_MULTI_CORE_EVENT_BUFFER_ALIGNMENT ((uint32_t)sizeof(TraceUnsignedBaseType_t))
+#endif
+
 traceResult xTraceMultiCoreEventBufferInitialize(TraceMultiCoreEventBuffer_t* const pxTraceMultiCoreEventBuffer, uint32_t uiOptions,
 	uint8_t* puiBuffer, uint32_t uiSize)
 {
 	uint32_t i;
 	uint32_t uiBufferSizePerCore;
+	uint32_t uiOffset = 0u;
+#ifdef TRC_CFG_CORE_BUFFER_WEIGHTS
+	uint32_t uiWeightSum = 0u;
+#endif
+#if (TRC_CFG_EVENT_BUFFER_POWER_OF_TWO == 1)
+	uint32_t uiEventBufferSize;
+#endif
 
 	/* This should never fail */
 	TRC_ASSERT(pxTraceMultiCoreEventBuffer != (void*)0);
@@ -24,25 +46,69 @@ traceResult xTraceMultiCoreEventBufferInitialize(TraceMultiCoreEventBuffer_t* co
 	/* This should never fail */
 	TRC_ASSERT(puiBuffer != (void*)0);
 
-	uiBufferSizePerCore = ((uiSize / (uint32_t)(TRC_CFG_CORE_COUNT)) / sizeof(TraceUnsignedBaseType_t)) * sizeof(TraceUnsignedBaseType_t); /* BaseType aligned */
+#if (TRC_CFG_CACHE_LINE_SIZE > 0)
+	/* Skip ahead to the first cache line boundary */
+	uiOffset = (TRC_MULTI_CORE_EVENT_BUFFER_ALIGNMENT - ((uint32_t)(TraceUnsignedBaseType_t)puiBuffer % TRC_MULTI_CORE_EVENT_BUFFER_ALIGNMENT)) % TRC_MULTI_CORE_EVENT_BUFFER_ALIGNMENT; /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 We need the address*/
 
 	/* This should never fail */
-	TRC_ASSERT(uiBufferSizePerCore != 0u);
+	TRC_ASSERT(uiSize > uiOffset);
+
+	uiSize -= uiOffset; /*cstat !MISRAC2012-Rule-17.8 Suppress modified function parameter check*/
+#endif
+
+#ifdef TRC_CFG_CORE_BUFFER_WEIGHTS
+	for (i = 0u; i < (uint32_t)(TRC_CFG_CORE_COUNT); i++)
+	{
+		/* We need to check this */
+		if (auiCoreBufferWeights[i] == 0u)
+		{
+			/* Every core needs room for at least the event buffer structure */
+			return TRC_FAIL;
+		}
+
+		uiWeightSum += auiCoreBufferWeights[i];
+	}
+#endif
 
 	for (i = 0u; i < (uint32_t)(TRC_CFG_CORE_COUNT); i++)
 	{
+#ifdef TRC_CFG_CORE_BUFFER_WEIGHTS
+		uiBufferSizePerCore = (((uiSize / uiWeightSum) * auiCoreBufferWeights[i]) / TRC_MULTI_CORE_EVENT_BUFFER_ALIGNMENT) * TRC_MULTI_CORE_EVENT_BUFFER_ALIGNMENT; /* BaseType or cache line aligned */
+#else
+		uiBufferSizePerCore = ((uiSize / (uint32_t)(TRC_CFG_CORE_COUNT)) / TRC_MULTI_CORE_EVENT_BUFFER_ALIGNMENT) * TRC_MULTI_CORE_EVENT_BUFFER_ALIGNMENT; /* BaseType or cache line aligned */
+#endif
+
+		/* We need to check this */
+		if (uiBufferSizePerCore <= sizeof(TraceEventBuffer_t))
+		{
+			/* The share of this core is too small to hold any events */
+			return TRC_FAIL;
+		}
+
+#if (TRC_CFG_EVENT_BUFFER_POWER_OF_TWO == 1)
+		/* Round the event buffer of each core down to a power of two, the structure is placed before it */
+		uiEventBufferSize = 1u;
+		while ((uiEventBufferSize << 1) <= (uiBufferSizePerCore - sizeof(TraceEventBuffer_t)))
+		{
+			uiEventBufferSize <<= 1;
+		}
+		uiBufferSizePerCore = uiEventBufferSize + sizeof(TraceEventBuffer_t);
+#endif
+
 		/* Set the event buffer pointers to point into the allocated space we have been given, this ensures
 		 * a flat memory layout necessary for usage in streaming snaphot. */
-		pxTraceMultiCoreEventBuffer->xEventBuffer[i] = (TraceEventBuffer_t*)(&puiBuffer[i * uiBufferSizePerCore]); /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress conversion between pointer types checks*/ /*cstat !MISRAC2004-17.4_b We need to access a spcific point in the buffer*/
+		pxTraceMultiCoreEventBuffer->xEventBuffer[i] = (TraceEventBuffer_t*)(&puiBuffer[uiOffset]); /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress conversion between pointer types checks*/ /*cstat !MISRAC2004-17.4_b We need to access a spcific point in the buffer*/
 
 		/* Initialize the event buffer structure with its memory buffer placed following its own structure data. */
 		/* We need to check this */
 		if (xTraceEventBufferInitialize(pxTraceMultiCoreEventBuffer->xEventBuffer[i], uiOptions,
-			&puiBuffer[(i * uiBufferSizePerCore) + sizeof(TraceEventBuffer_t)], /*cstat !MISRAC2004-17.4_b We need to access a specific point in the buffer*/
+			&puiBuffer[uiOffset + sizeof(TraceEventBuffer_t)], /*cstat !MISRAC2004-17.4_b We need to access a specific point in the buffer*/
 			uiBufferSizePerCore - sizeof(TraceEventBuffer_t)) == TRC_FAIL)
 		{
 			return TRC_FAIL;
 		}
+
+		uiOffset += uiBufferSizePerCore;
 	}
 
 	return TRC_SUCCESS;
@@ -61,6 +127,43 @@ traceResult xTraceMultiCoreEventBufferAlloc(const TraceMultiCoreEventBuffer_t *
 	return xTraceEventBufferAlloc(pxTraceMultiCoreEventBuffer->xEventBuffer[TRC_CFG_GET_CURRENT_CORE()], uiSize, ppvData);
 }
 
+traceResult xTraceMultiCoreEventBufferPush(const TraceMultiCoreEventBuffer_t* const pxTraceMultiCoreEventBuffer,
+	void* pvData, uint32_t uiSize, int32_t* piBytesWritten)
+{
+	/* This should never fail */
+	TRC_ASSERT(pxTraceMultiCoreEventBuffer != (void*)0);
+
+	TRC_ASSERT((TRC_CFG_GET_CURRENT_CORE()) < (TRC_CFG_CORE_COUNT));
+
+	return xTraceEventBufferPush(pxTraceMultiCoreEventBuffer->xEventBuffer[TRC_CFG_GET_CURRENT_CORE()], pvData, uiSize, piBytesWritten);
+}
+
+#endif
+
+#if ((TRC_CFG_LOCK_FREE_ALLOCATION) == 1) && ((TRC_CFG_CORE_COUNT) > 1)
+/*cstat !MISRAC2012-Rule-5.1 Yes, these are long names*/
+traceResult xTraceMultiCoreEventBufferAllocCommit(const TraceMultiCoreEventBuffer_t * const pxTraceMultiCoreEventBuffer, void *pvData, uint32_t uiSize, int32_t *piBytesWritten)
+{
+	uint32_t uiCoreId;
+	TraceEventBuffer_t* pxEventBuffer;
+
+	/* This should never fail */
+	TRC_ASSERT(pxTraceMultiCoreEventBuffer != (void*)0);
+
+	/* The allocation was made without a critical section, so we might not be on the same core anymore */
+	for (uiCoreId = 0u; uiCoreId < (uint32_t)(TRC_CFG_CORE_COUNT); uiCoreId++)
+	{
+		pxEventBuffer = pxTraceMultiCoreEventBuffer->xEventBuffer[uiCoreId];
+
+		if (((uint8_t*)pvData >= pxEventBuffer->puiBuffer) && ((uint8_t*)pvData < &pxEventBuffer->puiBuffer[pxEventBuffer->uiSize])) /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+		{
+			return xTraceEventBufferAllocCommit(pxEventBuffer, pvData, uiSize, piBytesWritten);
+		}
+	}
+
+	return TRC_FAIL;
+}
+#elif ((TRC_CFG_USE_TRACE_ASSERT) == 1)
 /*cstat !MISRAC2012-Rule-5.1 Yes, these are long names*/
 traceResult xTraceMultiCoreEventBufferAllocCommit(const TraceMultiCoreEventBuffer_t * const pxTraceMultiCoreEventBuffer, void *pvData, uint32_t uiSize, int32_t *piBytesWritten)
 {
@@ -71,16 +174,323 @@ traceResult xTraceMultiCoreEventBufferAllocCommit(const TraceMultiCoreEventBuffe
 
 	return xTraceEventBufferAllocCommit(pxTraceMultiCoreEventBuffer->xEventBuffer[TRC_CFG_GET_CURRENT_CORE()], pvData, uiSize, piBytesWritten);
 }
+#endif
 
-traceResult xTraceMultiCoreEventBufferPush(const TraceMultiCoreEventBuffer_t* const pxTraceMultiCoreEventBuffer,
-	void* pvData, uint32_t uiSize, int32_t* piBytesWritten)
+#if (TRC_CFG_ORDERED_TRANSFER == 1)
+
+#if (TRC_CFG_COMPACT_EVENT_HEADER == 1)
+#error "TRC_CFG_ORDERED_TRANSFER can't be used together with TRC_CFG_COMPACT_EVENT_HEADER"
+#endif
+
+/* The maximum number of events that are transferred from one core before the cores are compared again */
+#define TRC_MULTI_CORE_EVENT_BUFFER_MAX_RUN (16U)
+
+/**
+ * @brief Gets the position of the event that follows a position in an event buffer.
+ *
+ * @param[in] pxEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiHead Head of the event buffer.
+ * @param[in] uiPosition Position, possibly past the end of the buffer.
+ *
+ * @returns The position of the event.
+ */
+static uint32_t prvTraceMultiCoreEventBufferWrap(const TraceEventBuffer_t* pxEventBuffer, uint32_t uiHead, uint32_t uiPosition)
 {
+	/* Pushed events may wrap at the end of the buffer */
+	if (uiPosition >= pxEventBuffer->uiSize)
+	{
+		uiPosition -= pxEventBuffer->uiSize;
+	}
+
+	/* Allocated events are never placed in the slack area at the end of the buffer */
+	if ((uiHead < uiPosition) && (uiPosition >= (pxEventBuffer->uiSize - pxEventBuffer->uiSlack)))
+	{
+		uiPosition = 0u;
+	}
+
+	return uiPosition;
+}
+
+/**
+ * @brief Gets the timestamp and size of an event in an event buffer.
+ *
+ * @param[in] pxEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiPosition Position of the event.
+ * @param[out] puiTimestamp Timestamp of the event.
+ * @param[out] puiSize Size of the event.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+static traceResult prvTraceMultiCoreEventBufferPeek(const TraceEventBuffer_t* pxEventBuffer, uint32_t uiPosition, uint32_t* puiTimestamp, uint32_t* puiSize)
+{
+	/* The timestamp follows the event ID and the event count (or core ID with the extended header) */
+	uint32_t uiTimestampPosition = uiPosition + sizeof(uint32_t);
+
+	/* This should never fail */
+	TRC_ASSERT_ALWAYS_EVALUATE(xTraceEventGetSize(&pxEventBuffer->puiBuffer[uiPosition], puiSize) == TRC_SUCCESS); /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+
+	/* The header of a pushed event may wrap at the end of the buffer */
+	if (uiTimestampPosition >= pxEventBuffer->uiSize)
+	{
+		uiTimestampPosition -= pxEventBuffer->uiSize;
+	}
+
+	*puiTimestamp = *(uint32_t*)&pxEventBuffer->puiBuffer[uiTimestampPosition]; /*cstat !MISRAC2004-11.4 !MISRAC2012-Rule-11.3 Suppress conversion between pointer types checks*/ /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+
+	return TRC_SUCCESS;
+}
+
+/**
+ * @brief Transfers a number of bytes from the tail of an event buffer.
+ *
+ * @param[in] pxEventBuffer Pointer to initialized trace event buffer.
+ * @param[in] uiHead Head of the event buffer.
+ * @param[in] uiSize Number of bytes to transfer.
+ * @param[out] piBytesWritten Bytes written, less than uiSize if the stream port is busy.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+static traceResult prvTraceMultiCoreEventBufferTransferBytes(TraceEventBuffer_t* pxEventBuffer, uint32_t uiHead, uint32_t uiSize, int32_t* piBytesWritten)
+{
+	int32_t iBytesWritten = 0;
+
+	*piBytesWritten = 0;
+
+	while ((uint32_t)*piBytesWritten < uiSize)
+	{
+		/* Move the tail out of the slack area, which TransferChunk would do without writing anything */
+		TRC_PORT_STORE_RELEASE_32(&pxEventBuffer->uiTail, prvTraceMultiCoreEventBufferWrap(pxEventBuffer, uiHead, pxEventBuffer->uiTail));
+
+		/* We need to check this */
+		if (xTraceEventBufferTransferChunk(pxEventBuffer, uiSize - (uint32_t)*piBytesWritten, &iBytesWritten) == TRC_FAIL)
+		{
+			return TRC_FAIL;
+		}
+
+		if (iBytesWritten <= 0)
+		{
+			break;
+		}
+
+		*piBytesWritten += iBytesWritten;
+	}
+
+	return TRC_SUCCESS;
+}
+
+/**
+ * @brief Transfers the events of all cores, oldest first.
+ *
+ * Events are transferred in runs from one core, until another core has an
+ * older event. Data that is not ordered, e.g. the trace header, is
+ * transferred first.
+ *
+ * @param[in] pxTraceMultiCoreEventBuffer Pointer to initialized multi-core event buffer.
+ * @param[in] uiMaxBytes Maximum number of bytes to transfer.
+ * @param[out] piBytesWritten Bytes written.
+ *
+ * @retval TRC_FAIL Failure
+ * @retval TRC_SUCCESS Success
+ */
+static traceResult prvTraceMultiCoreEventBufferTransferOrdered(const TraceMultiCoreEventBuffer_t* const pxTraceMultiCoreEventBuffer, uint32_t uiMaxBytes, int32_t* piBytesWritten)
+{
+	TraceEventBuffer_t* pxEventBuffer;
+	uint32_t auiHead[TRC_CFG_CORE_COUNT];
+	uint32_t auiRunEnd[TRC_MULTI_CORE_EVENT_BUFFER_MAX_RUN];
+	uint32_t uiCoreId;
+	uint32_t uiOldestCore;
+	uint32_t uiOldestTimestamp = 0u;
+	uint32_t uiLimitTimestamp = 0u;
+	uint32_t uiHasLimit;
+	uint32_t uiTimestamp = 0u;
+	uint32_t uiSize = 0u;
+	uint32_t uiPosition;
+	uint32_t uiRunBytes;
+	uint32_t uiRunEvents;
+	uint32_t uiBytesWritten = 0u;
+	uint32_t i;
+	int32_t iBytesWritten = 0;
+
+	/* Data stored during the transfer is left for the next transfer */
+	for (uiCoreId = 0u; uiCoreId < (uint32_t)(TRC_CFG_CORE_COUNT); uiCoreId++)
+	{
+		auiHead[uiCoreId] = TRC_PORT_LOAD_ACQUIRE_32(&pxTraceMultiCoreEventBuffer->xEventBuffer[uiCoreId]->uiHead);
+	}
+
+	for (uiCoreId = 0u; uiCoreId < (uint32_t)(TRC_CFG_CORE_COUNT); uiCoreId++)
+	{
+		pxEventBuffer = pxTraceMultiCoreEventBuffer->xEventBuffer[uiCoreId];
+
+		if (pxEventBuffer->uiUnorderedBytes != 0u)
+		{
+			uiSize = pxEventBuffer->uiUnorderedBytes;
+			if (uiSize > uiMaxBytes)
+			{
+				uiSize = uiMaxBytes;
+			}
+
+			/* We need to check this */
+			if (prvTraceMultiCoreEventBufferTransferBytes(pxEventBuffer, auiHead[uiCoreId], uiSize, &iBytesWritten) == TRC_FAIL)
+			{
+				return TRC_FAIL;
+			}
+
+			pxEventBuffer->uiUnorderedBytes -= (uint32_t)iBytesWritten;
+			uiBytesWritten += (uint32_t)iBytesWritten;
+			uiMaxBytes -= (uint32_t)iBytesWritten;
+
+			/* The events that follow can't be sent before this data */
+			if (pxEventBuffer->uiUnorderedBytes != 0u)
+			{
+				*piBytesWritten = (int32_t)uiBytesWritten;
+
+				return TRC_SUCCESS;
+			}
+		}
+	}
+
+	while (uiMaxBytes != 0u)
+	{
+		/* Find the core with the oldest event, and the oldest event of the other cores */
+		uiOldestCore = (uint32_t)(TRC_CFG_CORE_COUNT);
+		uiHasLimit = 0u;
+
+		for (uiCoreId = 0u; uiCoreId < (uint32_t)(TRC_CFG_CORE_COUNT); uiCoreId++)
+		{
+			pxEventBuffer = pxTraceMultiCoreEventBuffer->xEventBuffer[uiCoreId];
+
+			uiPosition = prvTraceMultiCoreEventBufferWrap(pxEventBuffer, auiHead[uiCoreId], pxEventBuffer->uiTail);
+			if (uiPosition == auiHead[uiCoreId])
+			{
+				continue;
+			}
+
+			/* This should never fail */
+			TRC_ASSERT_ALWAYS_EVALUATE(prvTraceMultiCoreEventBufferPeek(pxEventBuffer, uiPosition, &uiTimestamp, &uiSize) == TRC_SUCCESS);
+
+			/* Timestamps wrap around, so they are compared by their difference */
+			if (uiOldestCore == (uint32_t)(TRC_CFG_CORE_COUNT))
+			{
+				uiOldestCore = uiCoreId;
+				uiOldestTimestamp = uiTimestamp;
+			}
+			else if ((int32_t)(uiTimestamp - uiOldestTimestamp) < 0)
+			{
+				uiLimitTimestamp = uiOldestTimestamp;
+				uiHasLimit = 1u;
+				uiOldestCore = uiCoreId;
+				uiOldestTimestamp = uiTimestamp;
+			}
+			else if ((uiHasLimit == 0u) || ((int32_t)(uiTimestamp - uiLimitTimestamp) < 0))
+			{
+				uiLimitTimestamp = uiTimestamp;
+				uiHasLimit = 1u;
+			}
+			else
+			{
+				/* Not among the two oldest */
+			}
+		}
+
+		/* All cores are empty */
+		if (uiOldestCore == (uint32_t)(TRC_CFG_CORE_COUNT))
+		{
+			break;
+		}
+
+		/* Collect the events of that core that are not newer than the oldest event of the other cores */
+		pxEventBuffer = pxTraceMultiCoreEventBuffer->xEventBuffer[uiOldestCore];
+		uiPosition = prvTraceMultiCoreEventBufferWrap(pxEventBuffer, auiHead[uiOldestCore], pxEventBuffer->uiTail);
+		uiRunBytes = 0u;
+		uiRunEvents = 0u;
+
+		while ((uiPosition != auiHead[uiOldestCore]) && (uiRunEvents < TRC_MULTI_CORE_EVENT_BUFFER_MAX_RUN))
+		{
+			/* This should never fail */
+			TRC_ASSERT_ALWAYS_EVALUATE(prvTraceMultiCoreEventBufferPeek(pxEventBuffer, uiPosition, &uiTimestamp, &uiSize) == TRC_SUCCESS);
+
+			if ((uiRunEvents != 0u) && (uiHasLimit != 0u) && ((int32_t)(uiTimestamp - uiLimitTimestamp) > 0))
+			{
+				break;
+			}
+
+			if ((uiRunBytes + uiSize) > uiMaxBytes)
+			{
+				break;
+			}
+
+			uiRunBytes += uiSize;
+			auiRunEnd[uiRunEvents] = uiRunBytes;
+			uiRunEvents++;
+
+			uiPosition = prvTraceMultiCoreEventBufferWrap(pxEventBuffer, auiHead[uiOldestCore], uiPosition + uiSize);
+		}
+
+		/* The next event doesn't fit in this transfer */
+		if (uiRunEvents == 0u)
+		{
+			break;
+		}
+
+		/* We need to check this */
+		if (prvTraceMultiCoreEventBufferTransferBytes(pxEventBuffer, auiHead[uiOldestCore], uiRunBytes, &iBytesWritten) == TRC_FAIL)
+		{
+			return TRC_FAIL;
+		}
+
+		uiBytesWritten += (uint32_t)iBytesWritten;
+		uiMaxBytes -= (uint32_t)iBytesWritten;
+
+		if ((uint32_t)iBytesWritten != uiRunBytes)
+		{
+			/* The stream port is busy. The rest of a partly written event must be sent first next time. */
+			for (i = 0u; i < uiRunEvents; i++)
+			{
+				if (auiRunEnd[i] > (uint32_t)iBytesWritten)
+				{
+					pxEventBuffer->uiUnorderedBytes = auiRunEnd[i] - (uint32_t)iBytesWritten;
+					break;
+				}
+			}
+
+			break;
+		}
+	}
+
+	*piBytesWritten = (int32_t)uiBytesWritten;
+
+	return TRC_SUCCESS;
+}
+
+/*cstat !MISRAC2012-Rule-5.1 Yes, these are long names*/
+traceResult xTraceMultiCoreEventBufferMarkUnordered(const TraceMultiCoreEventBuffer_t* const pxTraceMultiCoreEventBuffer)
+{
+	TraceEventBuffer_t* pxEventBuffer;
+	uint32_t uiHead;
+	uint32_t uiTail;
+
 	/* This should never fail */
 	TRC_ASSERT(pxTraceMultiCoreEventBuffer != (void*)0);
 
 	TRC_ASSERT((TRC_CFG_GET_CURRENT_CORE()) < (TRC_CFG_CORE_COUNT));
 
-	return xTraceEventBufferPush(pxTraceMultiCoreEventBuffer->xEventBuffer[TRC_CFG_GET_CURRENT_CORE()], pvData, uiSize, piBytesWritten);
+	pxEventBuffer = pxTraceMultiCoreEventBuffer->xEventBuffer[TRC_CFG_GET_CURRENT_CORE()];
+
+	uiHead = pxEventBuffer->uiHead;
+	uiTail = pxEventBuffer->uiTail;
+
+	if (uiHead >= uiTail)
+	{
+		pxEventBuffer->uiUnorderedBytes = uiHead - uiTail;
+	}
+	else
+	{
+		pxEventBuffer->uiUnorderedBytes = (pxEventBuffer->uiSize - uiTail - pxEventBuffer->uiSlack) + uiHead;
+	}
+
+	return TRC_SUCCESS;
 }
 
 #endif
@@ -99,6 +509,12 @@ traceResult xTraceMultiCoreEventBufferTransferAll(const TraceMultiCoreEventBuffe
 
 	*piBytesWritten = 0;
 
+#if (TRC_CFG_ORDERED_TRANSFER == 1)
+	(void)iBytesWritten;
+	(void)uiCoreId;
+
+	return prvTraceMultiCoreEventBufferTransferOrdered(pxTraceMultiCoreEventBuffer, 0xFFFFFFFFUL, piBytesWritten);
+#else
 	for (uiCoreId = 0u; uiCoreId < (uint32_t)(TRC_CFG_CORE_COUNT); uiCoreId++)
 	{
 		/* We need to check this */
@@ -111,6 +527,7 @@ traceResult xTraceMultiCoreEventBufferTransferAll(const TraceMultiCoreEventBuffe
 	}
 
 	return TRC_SUCCESS;
+#endif
 }
 
 /*cstat !MISRAC2012-Rule-5.1 Yes, these are long names*/
@@ -127,6 +544,12 @@ traceResult xTraceMultiCoreEventBufferTransferChunk(const TraceMultiCoreEventBuf
 
 	*piBytesWritten = 0;
 
+#if (TRC_CFG_ORDERED_TRANSFER == 1)
+	(void)iBytesWritten;
+	(void)uiCoreId;
+
+	return prvTraceMultiCoreEventBufferTransferOrdered(pxTraceMultiCoreEventBuffer, uiChunkSize * (uint32_t)(TRC_CFG_CORE_COUNT), piBytesWritten);
+#else
 	for (uiCoreId = 0u; uiCoreId < (uint32_t)(TRC_CFG_CORE_COUNT); uiCoreId++)
 	{
 		/* We need to check this */
@@ -139,6 +562,7 @@ traceResult xTraceMultiCoreEventBufferTransferChunk(const TraceMultiCoreEventBuf
 	}
 
 	return TRC_SUCCESS;
+#endif
 }
 
 traceResult xTraceMultiCoreEventBufferClear(const TraceMultiCoreEventBuffer_t* const pxTraceMultiCoreEventBuffer)
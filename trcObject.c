@@ -18,14 +18,33 @@
 #define TRC_SEND_NAME_ONLY_ON_DELETE 0
 #endif
 
+#if (TRC_CFG_ENTRY_LOCK_FREE_ALLOCATION == 1)
+/* Entry slots are taken without a critical section, and the hash index and
+ * symbol arena lock themselves, so registering an object needs no critical
+ * section of its own. The functions that find an object by address still
+ * hold one, so the object can't be created or deleted meanwhile. */
+#define TRACE_OBJECT_ALLOC_CRITICAL_SECTION()
+#define TRACE_OBJECT_ENTER_CRITICAL_SECTION()
+#define TRACE_OBJECT_EXIT_CRITICAL_SECTION()
+#else
+#define TRACE_OBJECT_ALLOC_CRITICAL_SECTION() TRACE_ALLOC_CRITICAL_SECTION()
+#define TRACE_OBJECT_ENTER_CRITICAL_SECTION() TRACE_ENTER_CRITICAL_SECTION()
+#define TRACE_OBJECT_EXIT_CRITICAL_SECTION() TRACE_EXIT_CRITICAL_SECTION()
+#endif
+
 /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
 traceResult xTraceObjectRegisterInternal(uint32_t uiEventCode, void* const pvObject, const char* szName, TraceUnsignedBaseType_t uxStateCount, const TraceUnsignedBaseType_t uxStates[], TraceUnsignedBaseType_t uxOptions, TraceObjectHandle_t* pxObjectHandle)
 {
 	TraceEntryHandle_t xEntryHandle;
 	TraceUnsignedBaseType_t i;
 	void *pvAddress;
+#if (TRC_CFG_OBJECT_REGISTER_BATCH == 1)
+	TraceEventBatch_t xBatch;
+	TraceUnsignedBaseType_t auxParams[4];
+	uint32_t uiLength;
+#endif
 
-	TRACE_ALLOC_CRITICAL_SECTION();
+	TRACE_OBJECT_ALLOC_CRITICAL_SECTION();
 
 	/* This should never fail */
 	TRC_ASSERT(pxObjectHandle != (void*)0);
@@ -33,14 +52,14 @@ traceResult xTraceObjectRegisterInternal(uint32_t uiEventCode, void* const pvObj
 	/* This should never fail */
 	TRC_ASSERT(uxStateCount <= (uint32_t)(TRC_ENTRY_TABLE_STATE_COUNT));
 
-	TRACE_ENTER_CRITICAL_SECTION();
+	TRACE_OBJECT_ENTER_CRITICAL_SECTION();
 
 	if (pvObject != (void*)0)
 	{
 		/* An address was supplied */
 		if (xTraceEntryCreateWithAddress(pvObject, &xEntryHandle) == TRC_FAIL)
 		{
-			TRACE_EXIT_CRITICAL_SECTION();
+			TRACE_OBJECT_EXIT_CRITICAL_SECTION();
 
 			return TRC_FAIL;
 		}
@@ -52,7 +71,7 @@ traceResult xTraceObjectRegisterInternal(uint32_t uiEventCode, void* const pvObj
 		/* No address was supplied */
 		if (xTraceEntryCreate(&xEntryHandle) == TRC_FAIL)
 		{
-			TRACE_EXIT_CRITICAL_SECTION();
+			TRACE_OBJECT_EXIT_CRITICAL_SECTION();
 
 			return TRC_FAIL;
 		}
@@ -71,8 +90,41 @@ traceResult xTraceObjectRegisterInternal(uint32_t uiEventCode, void* const pvObj
 
 	*pxObjectHandle = (TraceObjectHandle_t)xEntryHandle;
 
-	TRACE_EXIT_CRITICAL_SECTION();
+	TRACE_OBJECT_EXIT_CRITICAL_SECTION();
+
+#if (TRC_CFG_OBJECT_REGISTER_BATCH == 1)
+	if (uxStateCount > 3u)
+	{
+		return TRC_FAIL;
+	}
+
+	/* The name and the object are stored together, with the same timestamp */
+	(void)xTraceEventBatchBegin(&xBatch);
 
+	if ((szName != (void*)0) && (szName[0] != (char)0)) /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access every character in the string*/
+	{
+		/* Not a null or empty string */
+		for (uiLength = 0u; (szName[uiLength] != (char)0) && (uiLength < 128u); uiLength++) {} /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access every character in the string*/
+
+		/* This should never fail */
+		TRC_ASSERT_ALWAYS_EVALUATE(xTraceEntrySetSymbol(xEntryHandle, szName, uiLength) == TRC_SUCCESS);
+
+#if (TRC_SEND_NAME_ONLY_ON_DELETE == 0)
+		/* Attempt to send name event now since we don't do it on delete events */
+		auxParams[0] = (TraceUnsignedBaseType_t)pvAddress;
+		(void)xTraceEventBatchAddData(&xBatch, PSF_EVENT_OBJ_NAME, auxParams, 1u, szName, uiLength + 1u); /* +1 for termination */
+#endif /* (TRC_SEND_NAME_ONLY_ON_DELETE == 0) */
+	}
+
+	auxParams[0] = (TraceUnsignedBaseType_t)pvAddress;
+	for (i = 0u; i < uxStateCount; i++)
+	{
+		auxParams[i + 1u] = uxStates[i];
+	}
+	(void)xTraceEventBatchAdd(&xBatch, uiEventCode, auxParams, (uint32_t)uxStateCount + 1u);
+
+	(void)xTraceEventBatchEnd(&xBatch);
+#else
 	if ((szName != (void*)0) && (szName[0] != (char)0)) /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access every character in the string*/
 	{
 		/* Not a null or empty string */
@@ -99,6 +151,7 @@ traceResult xTraceObjectRegisterInternal(uint32_t uiEventCode, void* const pvObj
 			return TRC_FAIL;
 			break;
 	}
+#endif
 
 	return TRC_SUCCESS;
 }
@@ -119,22 +172,23 @@ traceResult xTraceObjectRegister2(uint32_t uiEventCode, void* const pvObject, co
 traceResult xTraceObjectUnregister(TraceObjectHandle_t xObjectHandle, uint32_t uiEventCode, TraceUnsignedBaseType_t uxState)
 {
 	void* pvObject = (void*)0;
-	const char *szName = (void*)0; /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
 #if (TRC_SEND_NAME_ONLY_ON_DELETE == 1)
+	const char *szName = (void*)0; /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
 	uint32_t uiLength;
 	uint32_t i;
-#endif
 
-	/* If asserts are disabled this variable will not get used, this stops warnings. */
-	(void)szName;
+	TRACE_ALLOC_CRITICAL_SECTION();
+#endif
 
 	/* This should never fail */
 	TRC_ASSERT_ALWAYS_EVALUATE(xTraceEntryGetAddress((TraceEntryHandle_t)xObjectHandle, &pvObject) == TRC_SUCCESS);
 
-	/* This should never fail */
-	TRC_ASSERT_ALWAYS_EVALUATE(xTraceEntryGetSymbol((TraceEntryHandle_t)xObjectHandle, &szName) == TRC_SUCCESS);
-
 #if (TRC_SEND_NAME_ONLY_ON_DELETE == 1)
+	/* The symbol may be moved when the symbol arena is compacted, so it is only used in a critical section */
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	(void)xTraceEntryGetSymbol((TraceEntryHandle_t)xObjectHandle, &szName);
+
 	/* Send name event because this is a delete */
 
 	for (i = 0u; (szName[i] != (char)0) && (i < 128u); i++) {} /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access every character in the string*/
@@ -143,6 +197,8 @@ traceResult xTraceObjectUnregister(TraceObjectHandle_t xObjectHandle, uint32_t u
 
 	/* Send the name event, if possible */
 	(void)xTraceEventCreateData1(PSF_EVENT_OBJ_NAME, (TraceUnsignedBaseType_t)pvObject, (TraceUnsignedBaseType_t*)szName, uiLength + 1); /* +1 for termination */
+
+	TRACE_EXIT_CRITICAL_SECTION();
 #endif /* (TRC_SEND_NAME_ONLY_ON_DELETE == 1) */
 
 	/* Send the delete event, if possible */
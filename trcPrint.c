@@ -14,7 +14,45 @@
 
 #include <stdarg.h>
 
-static traceResult prvTraceVPrintF(const TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, uint32_t uiArgs, va_list* pxVariableList);
+#if (TRC_CFG_PRINT_TYPED_ARGUMENTS == 1)
+#include <string.h>
+#endif
+
+#if (TRC_CFG_PRINT_INTERN_FORMAT_STRINGS == 1) && (TRC_CFG_ENTRY_HASH_INDEX == 0)
+#error "TRC_CFG_PRINT_INTERN_FORMAT_STRINGS requires TRC_CFG_ENTRY_HASH_INDEX"
+#endif
+
+/* The arguments of a format string are described by a uint32_t: the number of
+ * argument words in bits 0-3, the number of arguments in bits 4-7 and the type
+ * of each of the first 5 arguments in 2 bits each from bit 8. Descriptors made
+ * by parsing the format string are marked as parsed, other descriptors only
+ * count the arguments. */
+#define TRC_PRINT_FORMAT_VALID (0x80000000UL)
+#define TRC_PRINT_FORMAT_PARSED (0x40000000UL)
+#define TRC_PRINT_FORMAT_GET_WORDS(uiDescriptor) ((uiDescriptor) & 0xFUL)
+#define TRC_PRINT_FORMAT_GET_ARGS(uiDescriptor) (((uiDescriptor) >> 4) & 0xFUL)
+#define TRC_PRINT_FORMAT_GET_TYPE(uiDescriptor, uiArg) (((uiDescriptor) >> (8UL + (2UL * (uiArg)))) & 0x3UL)
+#define TRC_PRINT_FORMAT_PLAIN(uiArgs) (TRC_PRINT_FORMAT_VALID | ((uint32_t)(uiArgs) << 4) | (uint32_t)(uiArgs))
+
+#define TRC_PRINT_ARG_TYPE_WORD (0UL)
+#define TRC_PRINT_ARG_TYPE_INT64 (1UL)
+#define TRC_PRINT_ARG_TYPE_DOUBLE (2UL)
+#define TRC_PRINT_ARG_TYPE_LONG_DOUBLE (3UL)
+
+/* The number of argument words a 64-bit argument takes */
+#define TRC_PRINT_WIDE_ARG_WORDS ((uint32_t)(sizeof(uint64_t) / sizeof(TraceUnsignedBaseType_t)))
+
+static uint32_t prvTracePrintParseFormat(const char* szFormat, uint32_t* puiLength);
+static void prvTracePrintAddArg(uint32_t uiType, uint32_t* puiArgs, uint32_t* puiWords, uint32_t* puiTypes);
+static void prvTracePrintReadArgs(uint32_t uiDescriptor, va_list* pxVariableList, TraceUnsignedBaseType_t* puxArgs);
+static traceResult prvTracePrint(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, uint32_t uiArgs, const TraceUnsignedBaseType_t* puxArgs);
+static traceResult prvTracePrintFormat(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, uint32_t uiDescriptor, const TraceUnsignedBaseType_t* puxArgs);
+static traceResult prvTracePrintGetChannel(TraceStringHandle_t* pxChannel);
+
+#if (TRC_CFG_PRINT_INTERN_FORMAT_STRINGS == 1)
+static traceResult prvTracePrintInternFormat(const char* szFormat, uint32_t uiLength, uint32_t uiDescriptor);
+static traceResult prvTracePrintFixed(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiWords, const TraceUnsignedBaseType_t* puxArgs);
+#endif
 
 static TracePrintData_t *pxPrintData TRC_CFG_RECORDER_DATA_ATTRIBUTE;
 
@@ -54,7 +92,7 @@ traceResult xTracePrint(TraceStringHandle_t xChannel, const char* szString)
 
 	uiLength = i + 1u; /* Null termination */
 
-	return prvTraceVPrintF(xChannel, szString, uiLength, 0u, (va_list*)0);  /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 Suppress conversion of pointer to integer check*/ /*cstat !MISRAC2012-Rule-11.9 Suppress NULL recommendation*/
+	return prvTracePrint(xChannel, szString, uiLength, 0u, (void*)0);
 }
 
 /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-16.1 Suppress variable parameter count check*/
@@ -184,9 +222,13 @@ traceResult xTracePrintF(TraceStringHandle_t xChannel, const char* szFormat, ...
 /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2012-Rule-17.1 Suppress stdarg usage check*/
 traceResult xTraceVPrintF(TraceStringHandle_t xChannel, const char* szFormat, va_list* pxVariableList)
 {
-	uint32_t i;
-	uint32_t uiArgs = 0u;
+	uint32_t uiDescriptor;
 	uint32_t uiLength;
+	TraceUnsignedBaseType_t auxArgs[5];
+#if (TRC_CFG_PRINT_INTERN_FORMAT_STRINGS == 1)
+	TraceEntryHandle_t xEntryHandle;
+	TraceUnsignedBaseType_t uxDescriptor = 0u;
+#endif
 
 	/* We need to check this */
 	if (xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_PRINT) == 0U)
@@ -199,44 +241,353 @@ traceResult xTraceVPrintF(TraceStringHandle_t xChannel, const char* szFormat, va
 		szFormat = ""; /*cstat !MISRAC2012-Rule-17.8 Suppress modified function parameter check*/
 	}
 
-	/* Count the number of arguments in the format string (e.g., %d) */
-	for (i = 0u; (szFormat[i] != (char)0) && (i < 128u); i++) /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress char base type usage checks*/ /*cstat !MISRAC2012-Rule-14.2 Suppress malformed for loop due to i being incremented inside*/ /*cstat !MISRAC2004-17.4_b We need to access every character in the string*/
+#if (TRC_CFG_PRINT_INTERN_FORMAT_STRINGS == 1)
+	/* An interned format string has already been parsed, unless it was interned by xTracePrintFArgs */
+	if (xTraceEntryFind((const void*)szFormat, &xEntryHandle) == TRC_SUCCESS)
+	{
+		(void)xTraceEntryGetState(xEntryHandle, 0u, &uxDescriptor);
+
+		if (((uint32_t)uxDescriptor & (TRC_PRINT_FORMAT_VALID | TRC_PRINT_FORMAT_PARSED)) == (TRC_PRINT_FORMAT_VALID | TRC_PRINT_FORMAT_PARSED))
+		{
+			prvTracePrintReadArgs((uint32_t)uxDescriptor, pxVariableList, auxArgs);
+
+			return prvTracePrintFixed(xChannel, szFormat, TRC_PRINT_FORMAT_GET_WORDS((uint32_t)uxDescriptor), auxArgs);
+		}
+	}
+#endif
+
+	uiDescriptor = prvTracePrintParseFormat(szFormat, &uiLength);
+
+	/* We need to check this */
+	if (TRC_PRINT_FORMAT_GET_WORDS(uiDescriptor) > 5u)
+	{
+		return TRC_FAIL;
+	}
+
+	prvTracePrintReadArgs(uiDescriptor, pxVariableList, auxArgs);
+
+	return prvTracePrintFormat(xChannel, szFormat, uiLength, uiDescriptor, auxArgs);
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+traceResult xTracePrintFArgs(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, uint32_t uiArgs, const TraceUnsignedBaseType_t* puxArgs)
+{
+	/* We need to check this */
+	if (xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_PRINT) == 0U)
 	{
+		return TRC_FAIL;
+	}
+
+	/* This should never fail */
+	TRC_ASSERT((uiArgs == 0u) || (puxArgs != (void*)0));
+
+	if ((szFormat == (void*)0) || (uiLength == 0u))
+	{
+		szFormat = ""; /*cstat !MISRAC2012-Rule-17.8 Suppress modified function parameter check*/
+		uiLength = 1u; /*cstat !MISRAC2012-Rule-17.8 Suppress modified function parameter check*/
+	}
+
+	/* We need to check this */
+	if (uiArgs > 5u)
+	{
+		return TRC_FAIL;
+	}
+
+	return prvTracePrintFormat(xChannel, szFormat, uiLength, TRC_PRINT_FORMAT_PLAIN(uiArgs), puxArgs);
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+traceResult xTracePrintFArgs1(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1)
+{
+	TraceUnsignedBaseType_t auxArgs[1];
+
+	auxArgs[0] = uxParam1;
+
+	return xTracePrintFArgs(xChannel, szFormat, uiLength, 1u, auxArgs);
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+traceResult xTracePrintFArgs2(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1, TraceUnsignedBaseType_t uxParam2)
+{
+	TraceUnsignedBaseType_t auxArgs[2];
+
+	auxArgs[0] = uxParam1;
+	auxArgs[1] = uxParam2;
+
+	return xTracePrintFArgs(xChannel, szFormat, uiLength, 2u, auxArgs);
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+traceResult xTracePrintFArgs3(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1, TraceUnsignedBaseType_t uxParam2, TraceUnsignedBaseType_t uxParam3)
+{
+	TraceUnsignedBaseType_t auxArgs[3];
+
+	auxArgs[0] = uxParam1;
+	auxArgs[1] = uxParam2;
+	auxArgs[2] = uxParam3;
+
+	return xTracePrintFArgs(xChannel, szFormat, uiLength, 3u, auxArgs);
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+traceResult xTracePrintFArgs4(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1, TraceUnsignedBaseType_t uxParam2, TraceUnsignedBaseType_t uxParam3, TraceUnsignedBaseType_t uxParam4)
+{
+	TraceUnsignedBaseType_t auxArgs[4];
+
+	auxArgs[0] = uxParam1;
+	auxArgs[1] = uxParam2;
+	auxArgs[2] = uxParam3;
+	auxArgs[3] = uxParam4;
+
+	return xTracePrintFArgs(xChannel, szFormat, uiLength, 4u, auxArgs);
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+traceResult xTracePrintFArgs5(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, TraceUnsignedBaseType_t uxParam1, TraceUnsignedBaseType_t uxParam2, TraceUnsignedBaseType_t uxParam3, TraceUnsignedBaseType_t uxParam4, TraceUnsignedBaseType_t uxParam5)
+{
+	TraceUnsignedBaseType_t auxArgs[5];
+
+	auxArgs[0] = uxParam1;
+	auxArgs[1] = uxParam2;
+	auxArgs[2] = uxParam3;
+	auxArgs[3] = uxParam4;
+	auxArgs[4] = uxParam5;
+
+	return xTracePrintFArgs(xChannel, szFormat, uiLength, 5u, auxArgs);
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+static traceResult prvTracePrintFormat(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, uint32_t uiDescriptor, const TraceUnsignedBaseType_t* puxArgs)
+{
+	const uint32_t uiWords = TRC_PRINT_FORMAT_GET_WORDS(uiDescriptor);
+
+#if (TRC_CFG_PRINT_INTERN_FORMAT_STRINGS == 1)
+	if ((uiWords <= 4u) && (prvTracePrintInternFormat(szFormat, uiLength, uiDescriptor) == TRC_SUCCESS))
+	{
+		return prvTracePrintFixed(xChannel, szFormat, uiWords, puxArgs);
+	}
+#endif
+
+	return prvTracePrint(xChannel, szFormat, uiLength, uiWords, puxArgs);
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+static uint32_t prvTracePrintParseFormat(const char* szFormat, uint32_t* puiLength)
+{
+	uint32_t i = 0u;
+	uint32_t uiArgs = 0u;
+	uint32_t uiWords = 0u;
+	uint32_t uiTypes = 0u;
+	uint32_t uiType;
+
+	/* Find the arguments in the format string (e.g., %d) and their types */
+	while ((szFormat[i] != (char)0) && (i < 128u)) /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress char base type usage checks*/ /*cstat !MISRAC2004-17.4_b We need to access every character in the string*/
+	{
+		if (szFormat[i] != '%') /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
+		{
+			i++;
+			continue; /*cstat !MISRAC2004-14.5 Suppress continue usage check*/
+		}
+
+		i++;
+
 		if (szFormat[i] == '%') /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
 		{
-			if (szFormat[i + 1u] == (char)0) /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
+			/* Move past non-argument '%' */
+			i++;
+			continue; /*cstat !MISRAC2004-14.5 Suppress continue usage check*/
+		}
+
+		if (szFormat[i] == (char)0) /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
+		{
+			/* Found end of string */
+			break; /*cstat !MISRAC2004-14.6 Suppress break usage check*/
+		}
+
+		/* Move past flags, width and precision */
+		while (((szFormat[i] >= '0') && (szFormat[i] <= '9')) || (szFormat[i] == '-') || (szFormat[i] == '+') || (szFormat[i] == ' ') || (szFormat[i] == '#') || (szFormat[i] == '.') || (szFormat[i] == '*')) /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
+		{
+			if (szFormat[i] == '*') /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
 			{
-				/* Found end of string, let for loop detect it */
-				continue; /*cstat !MISRAC2004-14.5 Suppress continue usage check*/
+				/* The width or precision is an int argument of its own */
+				prvTracePrintAddArg(TRC_PRINT_ARG_TYPE_WORD, &uiArgs, &uiWords, &uiTypes);
 			}
+			i++;
+		}
 
-			if (szFormat[i + 1u] != '%') /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
+		/* Move past length modifiers, and find the arguments that are wider than int */
+		uiType = TRC_PRINT_ARG_TYPE_WORD;
+		while ((szFormat[i] == 'h') || (szFormat[i] == 'l') || (szFormat[i] == 'L') || (szFormat[i] == 'j') || (szFormat[i] == 'z') || (szFormat[i] == 't')) /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
+		{
+#if (TRC_CFG_PRINT_TYPED_ARGUMENTS == 1)
+			switch (szFormat[i]) /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
 			{
-				uiArgs++;        /* Found an argument */
+				case 'l':
+					/* long long, or a 64-bit long */
+					if ((szFormat[i + 1u] == 'l') || (sizeof(long) == sizeof(uint64_t))) /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
+					{
+						uiType = TRC_PRINT_ARG_TYPE_INT64;
+					}
+					break;
+				case 'j':
+					/* intmax_t */
+					uiType = TRC_PRINT_ARG_TYPE_INT64;
+					break;
+				case 'z':
+				case 't':
+					/* size_t and ptrdiff_t */
+					if (sizeof(size_t) == sizeof(uint64_t))
+					{
+						uiType = TRC_PRINT_ARG_TYPE_INT64;
+					}
+					break;
+				case 'L':
+					uiType = TRC_PRINT_ARG_TYPE_LONG_DOUBLE;
+					break;
+				default:
+					/* 'h' arguments are promoted to int */
+					break;
 			}
+#endif
+			i++;
+		}
 
-			/* Move past format specifier or non-argument '%' */
-			i++; /*cstat !MISRAC2004-13.6 Suppress i increment inside for loop check*/
+#if (TRC_CFG_PRINT_TYPED_ARGUMENTS == 1)
+		switch (szFormat[i]) /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
+		{
+			case 'f':
+			case 'F':
+			case 'e':
+			case 'E':
+			case 'g':
+			case 'G':
+			case 'a':
+			case 'A':
+				/* float is promoted to double */
+				if (uiType != TRC_PRINT_ARG_TYPE_LONG_DOUBLE)
+				{
+					uiType = TRC_PRINT_ARG_TYPE_DOUBLE;
+				}
+				break;
+			default:
+				if (uiType == TRC_PRINT_ARG_TYPE_LONG_DOUBLE)
+				{
+					/* 'L' only applies to floating-point conversions */
+					uiType = TRC_PRINT_ARG_TYPE_WORD;
+				}
+				break;
+		}
+#endif
+
+		/* Found an argument */
+		prvTracePrintAddArg(uiType, &uiArgs, &uiWords, &uiTypes);
+
+		if (szFormat[i] != (char)0) /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access a specific character in the string*/
+		{
+			/* Move past conversion specifier */
+			i++;
 		}
 	}
 
-	uiLength = i + 1u; /* Null termination */
+	*puiLength = i + 1u; /* Null termination */
+
+	if (uiWords > 15u)
+	{
+		uiWords = 15u;
+	}
 
-	return prvTraceVPrintF(xChannel, szFormat, uiLength, uiArgs, pxVariableList);
+	return TRC_PRINT_FORMAT_VALID | TRC_PRINT_FORMAT_PARSED | (uiTypes << 8) | (uiArgs << 4) | uiWords;
 }
 
-/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2012-Rule-17.1 Suppress stdarg usage check*/
-static traceResult prvTraceVPrintF(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, uint32_t uiArgs, va_list* pxVariableList)
+static void prvTracePrintAddArg(uint32_t uiType, uint32_t* puiArgs, uint32_t* puiWords, uint32_t* puiTypes)
+{
+	if (*puiArgs < 5u)
+	{
+		*puiTypes |= uiType << (2u * *puiArgs);
+	}
+	if (*puiArgs < 15u)
+	{
+		(*puiArgs)++;
+		*puiWords += (uiType == TRC_PRINT_ARG_TYPE_WORD) ? 1u : TRC_PRINT_WIDE_ARG_WORDS;
+	}
+}
+
+/*cstat !MISRAC2012-Rule-17.1 Suppress stdarg usage check*/
+static void prvTracePrintReadArgs(uint32_t uiDescriptor, va_list* pxVariableList, TraceUnsignedBaseType_t* puxArgs)
+{
+	const uint32_t uiArgs = TRC_PRINT_FORMAT_GET_ARGS(uiDescriptor);
+	uint32_t uiWord = 0u;
+	uint32_t i;
+#if (TRC_CFG_PRINT_TYPED_ARGUMENTS == 1)
+	uint64_t uxValue;
+	double dValue;
+#endif
+
+	for (i = 0u; i < uiArgs; i++)
+	{
+#if (TRC_CFG_PRINT_TYPED_ARGUMENTS == 1)
+		if (TRC_PRINT_FORMAT_GET_TYPE(uiDescriptor, i) == TRC_PRINT_ARG_TYPE_INT64)
+		{
+			/* Stored at its natural width, over several words if needed */
+			uxValue = va_arg(*pxVariableList, uint64_t);
+			memcpy(&puxArgs[uiWord], &uxValue, sizeof(uint64_t));
+			uiWord += TRC_PRINT_WIDE_ARG_WORDS;
+			continue; /*cstat !MISRAC2004-14.5 Suppress continue usage check*/
+		}
+
+		if (TRC_PRINT_FORMAT_GET_TYPE(uiDescriptor, i) == TRC_PRINT_ARG_TYPE_DOUBLE)
+		{
+			/* Stored as an IEEE 754 double, over several words if needed */
+			dValue = va_arg(*pxVariableList, double);
+			memcpy(&puxArgs[uiWord], &dValue, sizeof(double));
+			uiWord += TRC_PRINT_WIDE_ARG_WORDS;
+			continue; /*cstat !MISRAC2004-14.5 Suppress continue usage check*/
+		}
+
+		if (TRC_PRINT_FORMAT_GET_TYPE(uiDescriptor, i) == TRC_PRINT_ARG_TYPE_LONG_DOUBLE)
+		{
+			/* Stored as a double, like %f arguments */
+			dValue = (double)va_arg(*pxVariableList, long double);
+			memcpy(&puxArgs[uiWord], &dValue, sizeof(double));
+			uiWord += TRC_PRINT_WIDE_ARG_WORDS;
+			continue; /*cstat !MISRAC2004-14.5 Suppress continue usage check*/
+		}
+#endif
+
+		puxArgs[uiWord] = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
+		uiWord++;
+	}
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+static traceResult prvTracePrint(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiLength, uint32_t uiArgs, const TraceUnsignedBaseType_t* puxArgs)
 {
 	const uint32_t uiEventCode = PSF_EVENT_USER_EVENT + 1u + uiArgs; /* Add channel (1) */
-	traceResult xResult;
-	TraceUnsignedBaseType_t uxParam1;
-	TraceUnsignedBaseType_t uxParam2;
-	TraceUnsignedBaseType_t uxParam3;
-	TraceUnsignedBaseType_t uxParam4;
-	TraceUnsignedBaseType_t uxParam5;
+	TraceUnsignedBaseType_t auxParams[6];
+	TraceEventFragment_t xFormat;
+	uint32_t i;
+
+	if (prvTracePrintGetChannel(&xChannel) == TRC_FAIL)
+	{
+		return TRC_FAIL;
+	}
 
-	if (xChannel == 0)
+	auxParams[0] = (TraceUnsignedBaseType_t)xChannel;
+	for (i = 0u; i < uiArgs; i++)
+	{
+		auxParams[i + 1u] = puxArgs[i];
+	}
+
+	/* The format string is copied straight into the event, without reading past its end */
+	xFormat.pvData = szFormat;
+	xFormat.uiSize = uiLength;
+
+	return xTraceEventCreateDataV(uiEventCode, auxParams, uiArgs + 1u, &xFormat, 1u);
+}
+
+static traceResult prvTracePrintGetChannel(TraceStringHandle_t* pxChannel)
+{
+	if (*pxChannel == 0)
 	{
 		if (pxPrintData->defaultChannel == 0)
 		{
@@ -247,90 +598,83 @@ static traceResult prvTraceVPrintF(TraceStringHandle_t xChannel, const char* szF
 			}
 		}
 
-		xChannel = pxPrintData->defaultChannel; /*cstat !MISRAC2012-Rule-17.8 Suppress modified function parameter check*/
+		*pxChannel = pxPrintData->defaultChannel;
 	}
 
-	switch (uiArgs)
+	return TRC_SUCCESS;
+}
+
+#if (TRC_CFG_PRINT_INTERN_FORMAT_STRINGS == 1)
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+static traceResult prvTracePrintInternFormat(const char* szFormat, uint32_t uiLength, uint32_t uiDescriptor)
+{
+	TraceEntryHandle_t xEntryHandle;
+	TraceUnsignedBaseType_t uxAddress;
+	TraceUnsignedBaseType_t uxDescriptor = 0u;
+	TraceEventFragment_t xFormat;
+
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	/* Known format strings are found without a critical section. The descriptor is only valid once the format string has been stored. */
+	if ((xTraceEntryFind((const void*)szFormat, &xEntryHandle) == TRC_SUCCESS) &&
+		(xTraceEntryGetState(xEntryHandle, 0u, &uxDescriptor) == TRC_SUCCESS) &&
+		(((uint32_t)uxDescriptor & TRC_PRINT_FORMAT_VALID) != 0UL))
 	{
-		case 0:
-			xResult = xTraceEventCreateData1(uiEventCode, (TraceUnsignedBaseType_t)xChannel, (TraceUnsignedBaseType_t*)szFormat, uiLength);
-			break;
-		case 1:
-			uxParam1 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			xResult = xTraceEventCreateData2(
-				uiEventCode,
-				(TraceUnsignedBaseType_t)xChannel,
-				uxParam1,
-				(TraceUnsignedBaseType_t*)szFormat,
-				uiLength
-			);
-			break;
-		case 2:
-			uxParam1 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam2 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			xResult = xTraceEventCreateData3(
-				uiEventCode,
-				(TraceUnsignedBaseType_t)xChannel,
-				uxParam1,
-				uxParam2,
-				(TraceUnsignedBaseType_t*)szFormat,
-				uiLength
-			);
-			break;
-		case 3:
-			uxParam1 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam2 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam3 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			xResult = xTraceEventCreateData4(
-				uiEventCode,
-				(TraceUnsignedBaseType_t)xChannel,
-				uxParam1,
-				uxParam2,
-				uxParam3,
-				(TraceUnsignedBaseType_t*)szFormat,
-				uiLength
-			);
-			break;
-		case 4:
-			uxParam1 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam2 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam3 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam4 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			xResult = xTraceEventCreateData5(
-				uiEventCode,
-				(TraceUnsignedBaseType_t)xChannel,
-				uxParam1,
-				uxParam2,
-				uxParam3,
-				uxParam4,
-				(TraceUnsignedBaseType_t*)szFormat,
-				uiLength
-			);
-			break;
-		case 5:
-			uxParam1 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam2 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam3 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam4 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			uxParam5 = va_arg(*pxVariableList, TraceUnsignedBaseType_t);
-			xResult = xTraceEventCreateData6(
-				uiEventCode,
-				(TraceUnsignedBaseType_t)xChannel,
-				uxParam1,
-				uxParam2,
-				uxParam3,
-				uxParam4,
-				uxParam5,
-				(TraceUnsignedBaseType_t*)szFormat,
-				uiLength
-			);
-			break;
-		default:
-			xResult = TRC_FAIL;
-			break;
+		return TRC_SUCCESS;
 	}
 
-	return xResult;
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	/* Check again in case another task registered it in the meantime */
+	if (xTraceEntryFind((const void*)szFormat, &xEntryHandle) == TRC_FAIL)
+	{
+		if (xTraceEntryCreateWithAddress((void*)szFormat, &xEntryHandle) == TRC_FAIL) /*cstat !MISRAC2004-11.5 !MISRAC2012-Rule-11.8 The address is only used as a key*/
+		{
+			TRACE_EXIT_CRITICAL_SECTION();
+
+			return TRC_FAIL;
+		}
+
+		/* This should never fail */
+		TRC_ASSERT_ALWAYS_EVALUATE(xTraceEntrySetSymbol(xEntryHandle, szFormat, uiLength - 1u) == TRC_SUCCESS);
+
+		/* The whole format string is sent once, the entry table only holds the beginning of it */
+		uxAddress = (TraceUnsignedBaseType_t)szFormat; /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 We need the address*/
+		xFormat.pvData = szFormat;
+		xFormat.uiSize = uiLength;
+		(void)xTraceEventCreateDataV(PSF_EVENT_OBJ_NAME, &uxAddress, 1u, &xFormat, 1u);
+
+		/* The parsed arguments are kept so that later calls can skip parsing. Prints that find the entry only refer to it from now on. */
+		/* This should never fail */
+		TRC_ASSERT_ALWAYS_EVALUATE(xTraceEntrySetState(xEntryHandle, 0u, (TraceUnsignedBaseType_t)uiDescriptor) == TRC_SUCCESS);
+	}
+
+	TRACE_EXIT_CRITICAL_SECTION();
+
+	return TRC_SUCCESS;
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+static traceResult prvTracePrintFixed(TraceStringHandle_t xChannel, const char* szFormat, uint32_t uiWords, const TraceUnsignedBaseType_t* puxArgs)
+{
+	TraceUnsignedBaseType_t auxParams[6]; /* Channel, format string and up to 4 argument words */
+	uint32_t i;
+
+	if (prvTracePrintGetChannel(&xChannel) == TRC_FAIL)
+	{
+		return TRC_FAIL;
+	}
+
+	/* The format string is known by its address, so only the handle is sent */
+	auxParams[0] = (TraceUnsignedBaseType_t)xChannel;
+	auxParams[1] = (TraceUnsignedBaseType_t)szFormat; /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 We need the address*/
+	for (i = 0u; i < uiWords; i++)
+	{
+		auxParams[i + 2u] = puxArgs[i];
+	}
+
+	return xTraceEventCreateDataV(PSF_EVENT_USER_EVENT_FIXED + uiWords, auxParams, uiWords + 2u, (void*)0, 0u);
 }
+#endif
 
 #endif
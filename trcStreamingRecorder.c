@@ -17,7 +17,7 @@
 #endif
 
 /* Entry symbol length maximum check */
-#if ((TRC_CFG_ENTRY_SYMBOL_MAX_LENGTH) > 28UL)
+#if ((TRC_CFG_ENTRY_SYMBOL_MAX_LENGTH) > 28UL) && (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE == 0)
 #error Maximum entry symbol length is 28!
 #endif
 
@@ -91,7 +91,40 @@ uint32_t RecorderInitialized = 0u;
 uint32_t RecorderInitialized TRC_CFG_RECORDER_DATA_ATTRIBUTE;
 #endif /* (TRC_CFG_RECORDER_DATA_INIT != 0) */
 
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0) && (TRC_EXTERNAL_BUFFERS == 0)
+
+#if (TRC_USE_INTERNAL_BUFFER == 0)
+#error "TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE requires a stream port that uses the internal event buffer"
+#endif
+
+#include <string.h>
+
+/* What the incremental entry table dump is currently sending */
+#define TRC_ENTRY_TABLE_DUMP_STATE_IDLE 0u
+#define TRC_ENTRY_TABLE_DUMP_STATE_HEADER 1u
+#define TRC_ENTRY_TABLE_DUMP_STATE_TIMESTAMP 2u
+#define TRC_ENTRY_TABLE_DUMP_STATE_TABLE_HEADER 3u
+#define TRC_ENTRY_TABLE_DUMP_STATE_ENTRIES 4u
+
+typedef struct TraceEntryTableDump
+{
+	uint32_t uiState;
+	uint32_t uiSlot;							/* Next entry slot to look at */
+	uint32_t uiRemaining;						/* Entries left to send of those announced in the table header */
+	uint32_t uiOffset;							/* Bytes of the current data that have been written */
+	uint32_t uiSize;							/* Size of the current data */
+	const uint8_t* puiData;						/* The current data */
+	TraceUnsignedBaseType_t xTableHeader[3];
+	TraceTimestampData_t xTimestamp;			/* Copy of the timestamp info when tracing started */
+	TraceEntryRecord_t xEntry;					/* Copy of the entry being sent */
+} TraceEntryTableDump_t;
+
+static TraceEntryTableDump_t xEntryTableDump TRC_CFG_RECORDER_DATA_ATTRIBUTE; /*cstat !MISRAC2004-8.7 !MISRAC2012-Rule-8.9_a !MISRAC2012-Rule-8.9_b Suppress global variable check*/
+
+#endif
+
 #if (TRC_EXTERNAL_BUFFERS == 0)
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE == 0)
 /* Stores the header information on Start */
 static void prvTraceStoreHeader(void);
 
@@ -100,6 +133,19 @@ static void prvTraceStoreTimestampInfo(void);
 
 /* Stores the entry table on Start */
 static void prvTraceStoreEntryTable(void);
+#else
+/* Prepares sending the header and entry table from xTraceTzCtrl */
+static void prvTraceEntryTableDumpBegin(void);
+
+/* Sends the next part of the header and entry table without blocking */
+static traceResult prvTraceEntryTableDumpContinue(void);
+
+/* Sets the data the entry table dump will send next */
+static void prvTraceEntryTableDumpSetData(uint32_t uiState, const void* pvData, uint32_t uiSize);
+
+/* Copies the next entry that existed when tracing started */
+static void prvTraceEntryTableDumpNextEntry(void);
+#endif
 
 #else /* (TRC_EXTERNAL_BUFFERS == 0) */
 
@@ -124,6 +170,11 @@ static void prvSetRecorderEnabled(void);
 /* Internal function for stopping the recorder */
 static void prvSetRecorderDisabled(void);
 
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+/* Internal function for updating the event filter from a host command */
+static void prvSetEventFilter(const TraceCommand_t* const cmd);
+#endif
+
 /* Internal function for verifying size */
 static traceResult prvVerifySizeAlignment(uint32_t ulSize);
 
@@ -169,7 +220,7 @@ traceResult xTraceInitialize(void)
 	
 	for (i = 0; i < TRC_CFG_CORE_COUNT; i++)
 	{
-		pxTraceRecorderData->uxTraceSystemStates[i] = (TraceUnsignedBaseType_t)TRC_STATE_IN_STARTUP;
+		pxTraceRecorderData->uxTraceSystemStates[i].uxSystemState = (TraceUnsignedBaseType_t)TRC_STATE_IN_STARTUP;
 	}
 	
 	/*cstat !MISRAC2004-13.7_b Suppress always false check*/
@@ -200,6 +251,12 @@ traceResult xTraceInitialize(void)
 		return TRC_FAIL;
 	}
 
+	/*cstat !MISRAC2004-13.7_b !MISRAC2012-Rule-14.3_b Suppress always false check*/
+	if (xTraceStringInitialize(&pxTraceRecorderData->xStringBuffer) == TRC_FAIL)
+	{
+		return TRC_FAIL;
+	}
+
 	/*cstat !MISRAC2004-13.7_b !MISRAC2012-Rule-14.3_b Suppress always false check*/
 	if (xTraceStackMonitorInitialize(&pxTraceRecorderData->xStackMonitorBuffer) == TRC_FAIL)
 	{
@@ -340,6 +397,12 @@ traceResult xTraceHeaderInitialize(TraceHeaderBuffer_t *pxBuffer)
 		pxHeader->uiOptions |= (1 << 3);
 	}
 
+	/* 5th bit used for TRC_CFG_COMPACT_EVENT_HEADER */
+	pxHeader->uiOptions |= (((uint32_t)(TRC_CFG_COMPACT_EVENT_HEADER)) << 4);
+
+	/* 6th bit used for TRC_CFG_EXTENDED_EVENT_HEADER */
+	pxHeader->uiOptions |= (((uint32_t)(TRC_CFG_EXTENDED_EVENT_HEADER)) << 5);
+
 	return TRC_SUCCESS;
 }
 
@@ -446,6 +509,9 @@ traceResult xTraceTzCtrl(void)
 {
 	TraceCommand_t xCommand = { 0 };
 	int32_t iRxBytes;
+
+	/* Objects may be created in critical sections and ISRs, so the entry table grows from here */
+	(void)xTraceEntryTableGrow();
 	
 	do
 	{
@@ -469,7 +535,17 @@ traceResult xTraceTzCtrl(void)
 
 		if (xTraceIsRecorderEnabled())
 		{
-			(void)xTraceInternalEventBufferTransfer();
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0) && (TRC_EXTERNAL_BUFFERS == 0)
+			/* Events are held back in the internal event buffer until the header and entry table have been sent */
+			if (xEntryTableDump.uiState != TRC_ENTRY_TABLE_DUMP_STATE_IDLE)
+			{
+				(void)prvTraceEntryTableDumpContinue();
+			}
+			else
+#endif
+			{
+				(void)xTraceInternalEventBufferTransfer();
+			}
 		}
 
 		/* If there was data sent or received (bytes != 0), loop around and repeat, if there is more data to send or receive.
@@ -539,9 +615,18 @@ static void prvSetRecorderEnabled(void)
 	
 	(void)xTraceStreamPortOnTraceBegin();
 
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0) && (TRC_EXTERNAL_BUFFERS == 0)
+	/* The header and entry table are sent from xTraceTzCtrl, before any events */
+	prvTraceEntryTableDumpBegin();
+#else
 	prvTraceStoreHeader();
 	prvTraceStoreTimestampInfo();
 	prvTraceStoreEntryTable();
+
+	/* The header and entry table have no timestamps, and must be sent before any events */
+	(void)xTraceInternalEventBufferMarkUnordered();
+#endif
+
 	prvTraceStoreStartEvent();
 
 	pxTraceRecorderData->uiSessionCounter++;
@@ -564,12 +649,17 @@ static void prvSetRecorderDisabled(void)
 	
 	pxTraceRecorderData->uiRecorderEnabled = 0u;
 
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE > 0) && (TRC_EXTERNAL_BUFFERS == 0)
+	xEntryTableDump.uiState = TRC_ENTRY_TABLE_DUMP_STATE_IDLE;
+#endif
+
 	(void)xTraceStreamPortOnTraceEnd();
 
 	TRACE_EXIT_CRITICAL_SECTION();
 }
 
 #if (TRC_EXTERNAL_BUFFERS == 0)
+#if (TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE == 0)
 /* Stores the header information on Start */
 static void prvTraceStoreHeader(void)
 {
@@ -590,6 +680,9 @@ static void prvTraceStoreEntryTable(void)
 	uint32_t uiEntryCount;
 	TraceUnsignedBaseType_t xHeaderData[3];
 	void *pvEntryAddress;
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+	TraceEntryRecord_t xEntryRecord;
+#endif
 
 	(void)xTraceEntryGetCount(&uiEntryCount);
 
@@ -601,17 +694,158 @@ static void prvTraceStoreEntryTable(void)
 
 	for (i = 0; i < (TRC_ENTRY_TABLE_SLOTS); i++)
 	{
-		(void)xTraceEntryGetAtIndex(i, &xEntryHandle);
+		if (xTraceEntryGetAtIndex(i, &xEntryHandle) == TRC_FAIL)
+		{
+			/* The entry table has not grown into the remaining slots */
+			break;
+		}
 		(void)xTraceEntryGetAddress(xEntryHandle, &pvEntryAddress);
 
 		/* We only send used entry slots */
 		if (pvEntryAddress != 0)
 		{
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+			/* The symbol is stored in the arena, so the entry is sent in the fixed size layout the host expects */
+			(void)xTraceEntryGetRecord(xEntryHandle, &xEntryRecord);
+			xTraceEventCreateRawBlocking((TraceUnsignedBaseType_t *) &xEntryRecord, sizeof(TraceEntryRecord_t));
+#else
 			xTraceEventCreateRawBlocking((TraceUnsignedBaseType_t *) xEntryHandle, sizeof(TraceEntry_t));
+#endif
+		}
+	}
+
+}
+#else
+static void prvTraceEntryTableDumpBegin(void)
+{
+	/* Critical Section must be active! */
+	uint32_t uiEntryCount;
+
+	/* Entries created or deleted from now on are left out of the table, their events tell the host about them */
+	(void)xTraceEntryGenerationIncrease();
+
+	(void)xTraceEntryGetCount(&uiEntryCount);
+
+	xEntryTableDump.xTableHeader[0] = (TraceUnsignedBaseType_t)uiEntryCount;
+	xEntryTableDump.xTableHeader[1] = TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE;
+	xEntryTableDump.xTableHeader[2] = TRC_ENTRY_TABLE_STATE_COUNT;
+
+	xEntryTableDump.uiSlot = 0u;
+	xEntryTableDump.uiRemaining = uiEntryCount;
+
+	memcpy(&xEntryTableDump.xTimestamp, &pxTraceRecorderData->xTimestampBuffer, sizeof(TraceTimestampData_t));
+
+	prvTraceEntryTableDumpSetData(TRC_ENTRY_TABLE_DUMP_STATE_HEADER, pxHeader, sizeof(TraceHeader_t));
+}
+
+static traceResult prvTraceEntryTableDumpContinue(void)
+{
+	int32_t iBytesWritten;
+	uint32_t uiEntries = 0u;
+
+	while (xEntryTableDump.uiState != TRC_ENTRY_TABLE_DUMP_STATE_IDLE)
+	{
+		if (xEntryTableDump.uiOffset < xEntryTableDump.uiSize)
+		{
+			iBytesWritten = 0;
+
+			/* We need to check this */
+			if (xTraceStreamPortWriteData((void*)&xEntryTableDump.puiData[xEntryTableDump.uiOffset], xEntryTableDump.uiSize - xEntryTableDump.uiOffset, &iBytesWritten) == TRC_FAIL) /*cstat !MISRAC2004-17.4_b We need to access a specific part of the buffer*/
+			{
+				return TRC_FAIL;
+			}
+
+			xEntryTableDump.uiOffset += (uint32_t)iBytesWritten;
+
+			if (xEntryTableDump.uiOffset < xEntryTableDump.uiSize)
+			{
+				/* The stream port is busy, the rest is sent on the next call */
+				return TRC_SUCCESS;
+			}
+		}
+
+		if (xEntryTableDump.uiState == TRC_ENTRY_TABLE_DUMP_STATE_HEADER)
+		{
+			prvTraceEntryTableDumpSetData(TRC_ENTRY_TABLE_DUMP_STATE_TIMESTAMP, &xEntryTableDump.xTimestamp, sizeof(TraceTimestampData_t));
+		}
+		else if (xEntryTableDump.uiState == TRC_ENTRY_TABLE_DUMP_STATE_TIMESTAMP)
+		{
+			prvTraceEntryTableDumpSetData(TRC_ENTRY_TABLE_DUMP_STATE_TABLE_HEADER, xEntryTableDump.xTableHeader, sizeof(xEntryTableDump.xTableHeader));
+		}
+		else if (xEntryTableDump.uiRemaining == 0u)
+		{
+			/* All done, the events can now be transferred */
+			xEntryTableDump.uiState = TRC_ENTRY_TABLE_DUMP_STATE_IDLE;
+		}
+		else if (uiEntries == (uint32_t)(TRC_CFG_ENTRY_TABLE_DUMP_CHUNK_SIZE))
+		{
+			return TRC_SUCCESS;
+		}
+		else
+		{
+			prvTraceEntryTableDumpNextEntry();
+
+			prvTraceEntryTableDumpSetData(TRC_ENTRY_TABLE_DUMP_STATE_ENTRIES, &xEntryTableDump.xEntry, sizeof(TraceEntryRecord_t));
+
+			xEntryTableDump.uiRemaining--;
+			uiEntries++;
 		}
 	}
 
+	return TRC_SUCCESS;
+}
+
+static void prvTraceEntryTableDumpSetData(uint32_t uiState, const void* pvData, uint32_t uiSize)
+{
+	xEntryTableDump.uiState = uiState;
+	xEntryTableDump.puiData = (const uint8_t*)pvData;
+	xEntryTableDump.uiSize = uiSize;
+	xEntryTableDump.uiOffset = 0u;
 }
+
+static void prvTraceEntryTableDumpNextEntry(void)
+{
+	TraceEntryHandle_t xEntryHandle;
+	void *pvEntryAddress;
+	uint32_t uiChanged;
+
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	while (xEntryTableDump.uiSlot < (uint32_t)(TRC_ENTRY_TABLE_SLOTS))
+	{
+		if (xTraceEntryGetAtIndex(xEntryTableDump.uiSlot, &xEntryHandle) == TRC_FAIL)
+		{
+			/* The entry table has not grown into the remaining slots, which were all unused when tracing started */
+			xEntryTableDump.uiSlot = (uint32_t)(TRC_ENTRY_TABLE_SLOTS);
+
+			break;
+		}
+
+		/* Each entry is copied in its own critical section so interrupts are only disabled briefly */
+		TRACE_ENTER_CRITICAL_SECTION();
+
+		(void)xTraceEntryGetAddress(xEntryHandle, &pvEntryAddress);
+		(void)xTraceEntryIsChangedAtIndex(xEntryTableDump.uiSlot, &uiChanged);
+
+		xEntryTableDump.uiSlot++;
+
+		/* We only send entries that were used when tracing started */
+		if ((pvEntryAddress != 0) && (uiChanged == 0u))
+		{
+			(void)xTraceEntryGetRecord(xEntryHandle, &xEntryTableDump.xEntry);
+
+			TRACE_EXIT_CRITICAL_SECTION();
+
+			return;
+		}
+
+		TRACE_EXIT_CRITICAL_SECTION();
+	}
+
+	/* Entries deleted since tracing started are sent as unused entries, so the table still has the announced size */
+	memset(&xEntryTableDump.xEntry, 0, sizeof(TraceEntryRecord_t));
+}
+#endif
 #endif /* (TRC_EXTERNAL_BUFFERS == 0) */
 
 static void prvTraceStoreStartEvent(void)
@@ -672,11 +906,37 @@ static void prvProcessCommand(const TraceCommand_t* const cmd)
 				prvSetRecorderDisabled();
 			}
 		  	break;
+		case CMD_SET_EVENT_FILTER:
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+			prvSetEventFilter(cmd);
+#endif
+			break;
 		default:
 		  	break;
 	}
 }
 
+#if (TRC_CFG_ENABLE_EVENT_FILTER == 1)
+static void prvSetEventFilter(const TraceCommand_t* const cmd)
+{
+	uint32_t uiEventCode = (uint32_t)cmd->param1 | ((uint32_t)cmd->param2 << 8);
+	uint32_t uiCount = (cmd->param4 == 0u) ? 1u : (uint32_t)cmd->param4;
+	uint32_t i;
+
+	for (i = 0u; (i < uiCount) && ((uiEventCode + i) < (uint32_t)(TRC_EVENT_FILTER_ID_COUNT)); i++)
+	{
+		if (cmd->param3 == 1u)
+		{
+			(void)xTraceEventFilterExclude(uiEventCode + i);
+		}
+		else
+		{
+			(void)xTraceEventFilterInclude(uiEventCode + i);
+		}
+	}
+}
+#endif
+
 /* Do this in function to avoid unreachable code warnings */
 static traceResult prvVerifySizeAlignment(uint32_t ulSize)
 {
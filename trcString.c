@@ -12,12 +12,60 @@
 
 #if (TRC_USE_TRACEALYZER_RECORDER == 1) && (TRC_CFG_RECORDER_MODE == TRC_RECORDER_MODE_STREAMING)
 
+#include <string.h>
+
+#if (TRC_CFG_STRING_INTERN_SLOTS > 0)
+
+#if ((TRC_CFG_STRING_INTERN_SLOTS) & ((TRC_CFG_STRING_INTERN_SLOTS) - 1)) != 0
+#error "TRC_CFG_STRING_INTERN_SLOTS must be a power of two!"
+#endif
+
+#define TRC_STRING_INTERN_SLOTS_MASK ((uint32_t)(TRC_CFG_STRING_INTERN_SLOTS) - 1UL)
+
+/* No free slot found */
+#define TRC_STRING_INTERN_NO_SLOT (0xFFFFFFFFUL)
+
+static TraceStringData_t *pxStringData TRC_CFG_RECORDER_DATA_ATTRIBUTE;
+
+static uint32_t prvTraceStringHash(const char* szString, uint32_t uiLength);
+static uint32_t prvTraceStringIsRegistered(TraceStringHandle_t xString, const char* szString, uint32_t uiLength);
+
+traceResult xTraceStringInitialize(TraceStringData_t *pxBuffer)
+{
+	uint32_t i;
+
+	/* This should never fail */
+	TRC_ASSERT(pxBuffer != (void*)0);
+
+	pxStringData = pxBuffer;
+
+	for (i = 0u; i < (uint32_t)(TRC_CFG_STRING_INTERN_SLOTS); i++)
+	{
+		pxStringData->axInternTable[i] = 0;
+	}
+
+	(void)xTraceSetComponentInitialized(TRC_RECORDER_COMPONENT_STRING);
+
+	return TRC_SUCCESS;
+}
+
+#endif
+
 /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
 traceResult xTraceStringRegister(const char* szString, TraceStringHandle_t *pString)
 {
 	TraceEntryHandle_t xEntryHandle;
 	int32_t i;
 	uint32_t uiLength = 0u;
+#if (TRC_CFG_STRING_INTERN_SLOTS > 0)
+	uint32_t uiSymbolLength;
+	uint32_t uiSlot;
+	uint32_t uiFreeSlot = TRC_STRING_INTERN_NO_SLOT;
+	uint32_t j;
+	TraceStringHandle_t xString;
+
+	TRACE_ALLOC_CRITICAL_SECTION();
+#endif
 
 	/* This should never fail */
 	TRC_ASSERT(szString != (void*)0);
@@ -25,19 +73,84 @@ traceResult xTraceStringRegister(const char* szString, TraceStringHandle_t *pStr
 	/* This should never fail */
 	TRC_ASSERT(pString != (void*)0);
 
+	for (i = 0; (szString[i] != (char)0) && (i < (int32_t)(TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE)); i++) {} /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access every character in the string*/
+
+	uiLength = (uint32_t)i;
+
+#if (TRC_CFG_STRING_INTERN_SLOTS > 0)
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_STRING));
+
+	/* Strings are interned as stored in the entry table */
+	uiSymbolLength = (uiLength > (uint32_t)(TRC_ENTRY_TABLE_SYMBOL_LENGTH)) ? (uint32_t)(TRC_ENTRY_TABLE_SYMBOL_LENGTH) : uiLength;
+
+	uiSlot = prvTraceStringHash(szString, uiSymbolLength) & TRC_STRING_INTERN_SLOTS_MASK;
+
+	/* Looking up and creating the string must not be interrupted by a registration of the same string */
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	for (j = 0u; j < (uint32_t)(TRC_CFG_STRING_INTERN_SLOTS); j++)
+	{
+		xString = pxStringData->axInternTable[uiSlot];
+
+		if (xString == 0)
+		{
+			if (uiFreeSlot == TRC_STRING_INTERN_NO_SLOT)
+			{
+				uiFreeSlot = uiSlot;
+			}
+
+			break;
+		}
+
+		if (prvTraceStringIsRegistered(xString, szString, uiSymbolLength) == 1u)
+		{
+			TRACE_EXIT_CRITICAL_SECTION();
+
+			/* The host already knows this string, from the entry table or from its name event */
+			*pString = xString;
+
+			return TRC_SUCCESS;
+		}
+
+		if ((uiFreeSlot == TRC_STRING_INTERN_NO_SLOT) && (TRC_ENTRY_GET_ADDRESS_RETURN((TraceEntryHandle_t)xString) != (void*)xString))
+		{
+			/* The entry has been deleted since it was registered, so the slot can be reused */
+			uiFreeSlot = uiSlot;
+		}
+
+		uiSlot = (uiSlot + 1u) & TRC_STRING_INTERN_SLOTS_MASK;
+	}
+#endif
+
 	/* We need to check this */
 	if (xTraceEntryCreate(&xEntryHandle) == TRC_FAIL)
 	{
+#if (TRC_CFG_STRING_INTERN_SLOTS > 0)
+		TRACE_EXIT_CRITICAL_SECTION();
+#endif
+
 		return TRC_FAIL;
 	}
 
-	for (i = 0; (szString[i] != (char)0) && (i < (int32_t)(TRC_ENTRY_TABLE_SLOT_SYMBOL_SIZE)); i++) {} /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access every character in the string*/
-
-	uiLength = (uint32_t)i;
-
 	/* The address to the available symbol table slot is the address we use */
+#if (TRC_CFG_ENTRY_SYMBOL_ARENA_SIZE > 0)
+	/* If the symbol arena is full the string is only known from its name event. This is reported by the diagnostics. */
+	(void)xTraceEntrySetSymbol(xEntryHandle, szString, uiLength);
+#else
 	/* This should never fail */
 	TRC_ASSERT_ALWAYS_EVALUATE(xTraceEntrySetSymbol(xEntryHandle, szString, uiLength) == TRC_SUCCESS);
+#endif
+
+#if (TRC_CFG_STRING_INTERN_SLOTS > 0)
+	/* If the table is full the string is still registered, only not interned */
+	if (uiFreeSlot != TRC_STRING_INTERN_NO_SLOT)
+	{
+		pxStringData->axInternTable[uiFreeSlot] = (TraceStringHandle_t)xEntryHandle;
+	}
+
+	TRACE_EXIT_CRITICAL_SECTION();
+#endif
 
 	*pString = (TraceStringHandle_t)xEntryHandle;
 
@@ -53,4 +166,52 @@ TraceStringHandle_t xTraceRegisterString(const char *name)
 	return trcStr;
 }
 
+#if (TRC_CFG_STRING_INTERN_SLOTS > 0)
+
+/* FNV-1a */
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+static uint32_t prvTraceStringHash(const char* szString, uint32_t uiLength)
+{
+	uint32_t uiHash = 2166136261UL;
+	uint32_t i;
+
+	for (i = 0u; i < uiLength; i++)
+	{
+		uiHash ^= (uint32_t)(uint8_t)szString[i]; /*cstat !MISRAC2004-17.4_b We need to access every character in the string*/
+		uiHash *= 16777619UL;
+	}
+
+	return uiHash;
+}
+
+/*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+static uint32_t prvTraceStringIsRegistered(TraceStringHandle_t xString, const char* szString, uint32_t uiLength)
+{
+	/* Critical Section must be active! */
+	const char* szSymbol = (void*)0; /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/
+
+	/* A string entry uses its own address, unless it has been deleted */
+	if (TRC_ENTRY_GET_ADDRESS_RETURN((TraceEntryHandle_t)xString) != (void*)xString)
+	{
+		return 0u;
+	}
+
+	(void)xTraceEntryGetSymbol((TraceEntryHandle_t)xString, &szSymbol);
+
+	if (memcmp(szSymbol, szString, uiLength) != 0)
+	{
+		return 0u;
+	}
+
+	/* A symbol of maximum length is not null terminated */
+	if ((uiLength < (uint32_t)(TRC_ENTRY_TABLE_SYMBOL_LENGTH)) && (szSymbol[uiLength] != (char)0)) /*cstat !MISRAC2004-6.3 !MISRAC2012-Dir-4.6_a Suppress basic char type usage*/ /*cstat !MISRAC2004-17.4_b We need to access a specific character in the symbol*/
+	{
+		return 0u;
+	}
+
+	return 1u;
+}
+
+#endif
+
 #endif
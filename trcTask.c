@@ -16,6 +16,10 @@
 #define TRC_KERNEL_PORT_KERNEL_CAN_SWITCH_TO_SAME_TASK 1
 #endif
 
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1) && (TRC_CFG_ENTRY_HASH_INDEX == 0)
+#error "TRC_CFG_ENABLE_TASK_EXCLUSION requires TRC_CFG_ENTRY_HASH_INDEX"
+#endif
+
 /* Code used for "task address" when no task has started, to indicate "(startup)".
  * This value was used since NULL/0 was already reserved for the idle task. */
 #define TRACE_HANDLE_NO_TASK ((void*)2UL)
@@ -24,6 +28,11 @@
 
 TraceTaskData_t* pxTraceTaskData TRC_CFG_RECORDER_DATA_ATTRIBUTE;
 
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+static void prvTraceTaskUpdateExcluded(void* pvTask);
+static traceResult prvTraceTaskSetExcluded(void* pvTask, uint32_t uiExcluded);
+#endif
+
 traceResult xTraceTaskInitialize(TraceTaskData_t *pxBuffer)
 {
 	int32_t i;
@@ -36,8 +45,15 @@ traceResult xTraceTaskInitialize(TraceTaskData_t *pxBuffer)
 	for (i = 0; i < (TRC_CFG_CORE_COUNT); i++)
 	{
 		pxTraceTaskData->coreTasks[i] = TRACE_HANDLE_NO_TASK;  /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 Suppress conversion from pointer to integer check*/
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+		pxTraceTaskData->coreTasksExcluded[i] = 0u;
+#endif
 	}
 
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+	pxTraceTaskData->uxExcludedCount = 0u;
+#endif
+
 	(void)xTraceSetComponentInitialized(TRC_RECORDER_COMPONENT_TASK);
 
 	return TRC_SUCCESS;
@@ -98,6 +114,10 @@ traceResult xTraceTaskSwitch(void *pvTask, TraceUnsignedBaseType_t uxPriority)
 		/* Make sure we store the current task, even while recorder isn't enabled */
 		(void)xTraceTaskSetCurrent(pvTask);
 
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+		prvTraceTaskUpdateExcluded(pvTask);
+#endif
+
 		return xResult;
 	}
 
@@ -113,6 +133,10 @@ traceResult xTraceTaskSwitch(void *pvTask, TraceUnsignedBaseType_t uxPriority)
 		(void)xTraceTaskSetCurrent(pvTask);
 
 		xResult = xTraceEventCreate2(PSF_EVENT_TASK_ACTIVATE, (TraceUnsignedBaseType_t)pvTask, uxPriority);  /*cstat !MISRAC2004-11.3 !MISRAC2012-Rule-11.4 !MISRAC2012-Rule-11.6 Suppress conversion from pointer to integer check*/
+
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+		prvTraceTaskUpdateExcluded(pvTask);
+#endif
 	}
 
 	(void)xTraceStateSet(TRC_STATE_IN_APPLICATION);
@@ -122,4 +146,90 @@ traceResult xTraceTaskSwitch(void *pvTask, TraceUnsignedBaseType_t uxPriority)
 	return xResult;
 }
 
+#if (TRC_CFG_ENABLE_TASK_EXCLUSION == 1)
+
+traceResult xTraceTaskExclude(void* pvTask)
+{
+	return prvTraceTaskSetExcluded(pvTask, 1u);
+}
+
+traceResult xTraceTaskInclude(void* pvTask)
+{
+	return prvTraceTaskSetExcluded(pvTask, 0u);
+}
+
+static traceResult prvTraceTaskSetExcluded(void* pvTask, uint32_t uiExcluded)
+{
+	TraceEntryHandle_t xEntryHandle;
+	uint32_t uiOptions = 0u;
+	uint32_t i;
+
+	TRACE_ALLOC_CRITICAL_SECTION();
+
+	/* This should never fail */
+	TRC_ASSERT(xTraceIsComponentInitialized(TRC_RECORDER_COMPONENT_TASK));
+
+	TRACE_ENTER_CRITICAL_SECTION();
+
+	if (xTraceEntryFind(pvTask, &xEntryHandle) == TRC_FAIL)
+	{
+		TRACE_EXIT_CRITICAL_SECTION();
+
+		return TRC_FAIL;
+	}
+
+	/* This should never fail */
+	TRC_ASSERT_ALWAYS_EVALUATE(xTraceEntryGetOptions(xEntryHandle, &uiOptions) == TRC_SUCCESS);
+
+	if (uiExcluded != 0u)
+	{
+		if ((uiOptions & TRC_ENTRY_OPTION_EXCLUDED) == 0u)
+		{
+			/* This should never fail */
+			TRC_ASSERT_ALWAYS_EVALUATE(xTraceEntrySetOptions(xEntryHandle, TRC_ENTRY_OPTION_EXCLUDED) == TRC_SUCCESS);
+			pxTraceTaskData->uxExcludedCount++;
+		}
+	}
+	else
+	{
+		if ((uiOptions & TRC_ENTRY_OPTION_EXCLUDED) != 0u)
+		{
+			/* This should never fail */
+			TRC_ASSERT_ALWAYS_EVALUATE(xTraceEntryClearOptions(xEntryHandle, TRC_ENTRY_OPTION_EXCLUDED) == TRC_SUCCESS);
+			pxTraceTaskData->uxExcludedCount--;
+		}
+	}
+
+	/* The task may already be running */
+	for (i = 0u; i < (uint32_t)(TRC_CFG_CORE_COUNT); i++)
+	{
+		if (pxTraceTaskData->coreTasks[i] == pvTask)
+		{
+			pxTraceTaskData->coreTasksExcluded[i] = (TraceUnsignedBaseType_t)uiExcluded;
+		}
+	}
+
+	TRACE_EXIT_CRITICAL_SECTION();
+
+	return TRC_SUCCESS;
+}
+
+/* Looks up the exclude option of the task that is switched in, using the entry hash index. Called on the current core from the task switch. */
+static void prvTraceTaskUpdateExcluded(void* pvTask)
+{
+	TraceEntryHandle_t xEntryHandle;
+	uint32_t uiOptions = 0u;
+	TraceUnsignedBaseType_t uxExcluded = 0u;
+
+	if ((pxTraceTaskData->uxExcludedCount != 0u) && (pvTask != (void*)0) && (xTraceEntryFind(pvTask, &xEntryHandle) == TRC_SUCCESS))
+	{
+		(void)xTraceEntryGetOptions(xEntryHandle, &uiOptions);
+		uxExcluded = ((uiOptions & TRC_ENTRY_OPTION_EXCLUDED) != 0u) ? 1u : 0u;
+	}
+
+	pxTraceTaskData->coreTasksExcluded[TRC_CFG_GET_CURRENT_CORE()] = uxExcluded;
+}
+
+#endif
+
 #endif